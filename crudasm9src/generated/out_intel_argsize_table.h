@@ -0,0 +1,83 @@
+// out_intel_argsize_table.h  (note: this file was automatically generated -- do not edit!)
+// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.
+
+CRUDASM_TABLE_ALIGN const S1 crudasm_intel_argsize_rows[][CRUDASM_ARGSIZE_COMBOS][CRUDASM_MAX_ASM_ARGS] = {
+	{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},
+	{{1,0,0,0},{1,0,0,0},{1,0,0,0},{1,0,0,0},{1,0,0,0},{1,0,0,0},{1,0,0,0},{1,0,0,0},{1,0,0,0},{1,0,0,0}},
+	{{1,1,0,0},{1,1,0,0},{1,1,0,0},{1,1,0,0},{1,1,0,0},{1,1,0,0},{1,1,0,0},{1,1,0,0},{1,1,0,0},{1,1,0,0}},
+	{{2,2,0,0},{2,2,0,0},{4,4,0,0},{4,4,0,0},{2,2,0,0},{2,2,0,0},{4,4,0,0},{4,4,0,0},{8,8,0,0},{8,8,0,0}},
+	{{2,1,0,0},{2,1,0,0},{4,1,0,0},{4,1,0,0},{2,1,0,0},{2,1,0,0},{4,1,0,0},{4,1,0,0},{8,1,0,0},{8,1,0,0}},
+	{{4,16,0,0},{4,16,0,0},{4,16,0,0},{4,16,0,0},{8,16,0,0},{8,16,0,0},{8,16,0,0},{8,16,0,0},{8,16,0,0},{8,16,0,0}},
+	{{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0}},
+	{{4,4,0,0},{4,4,0,0},{4,4,0,0},{4,4,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0}},
+	{{8,8,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0},{8,8,0,0}},
+	{{16,16,0,0},{16,16,0,0},{16,16,0,0},{16,16,0,0},{16,16,0,0},{16,16,0,0},{16,16,0,0},{16,16,0,0},{16,16,0,0},{16,16,0,0}},
+	{{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0}},
+	{{4,4,0,0},{4,4,0,0},{4,4,0,0},{4,4,0,0},{4,4,0,0},{4,4,0,0},{4,4,0,0},{4,4,0,0},{4,4,0,0},{4,4,0,0}},
+	{{1,2,0,0},{1,2,0,0},{1,2,0,0},{1,2,0,0},{1,2,0,0},{1,2,0,0},{1,2,0,0},{1,2,0,0},{1,2,0,0},{1,2,0,0}},
+	{{2,2,0,0},{2,2,0,0},{4,2,0,0},{4,2,0,0},{2,2,0,0},{2,2,0,0},{4,2,0,0},{4,2,0,0},{8,2,0,0},{8,2,0,0}},
+	{{2,1,0,0},{2,1,0,0},{2,1,0,0},{2,1,0,0},{2,1,0,0},{2,1,0,0},{2,1,0,0},{2,1,0,0},{2,1,0,0},{2,1,0,0}},
+	{{2,2,0,0},{2,2,0,0},{2,4,0,0},{2,4,0,0},{2,2,0,0},{2,2,0,0},{2,4,0,0},{2,4,0,0},{2,8,0,0},{2,8,0,0}},
+	{{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0}},
+	{{2,4,0,0},{2,4,0,0},{4,4,0,0},{4,4,0,0},{2,4,0,0},{2,4,0,0},{4,4,0,0},{4,4,0,0},{8,4,0,0},{8,4,0,0}},
+	{{2,0,0,0},{2,0,0,0},{2,0,0,0},{2,0,0,0},{2,0,0,0},{2,0,0,0},{2,0,0,0},{2,0,0,0},{2,0,0,0},{2,0,0,0}},
+	{{2,0,0,0},{2,0,0,0},{4,0,0,0},{4,0,0,0},{2,0,0,0},{2,0,0,0},{4,0,0,0},{4,0,0,0},{8,0,0,0},{8,0,0,0}},
+	{{2,2,0,0},{2,2,0,0},{4,4,0,0},{4,4,0,0},{2,2,0,0},{2,2,0,0},{4,4,0,0},{4,4,0,0},{8,4,0,0},{8,4,0,0}},
+	{{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{4,0,0,0},{8,0,0,0},{8,0,0,0}},
+	{{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{16,0,0,0},{16,0,0,0}},
+	{{4,2,0,0},{4,2,0,0},{4,2,0,0},{4,2,0,0},{4,2,0,0},{4,2,0,0},{4,2,0,0},{4,2,0,0},{8,2,0,0},{8,2,0,0}},
+	{{2,2,1,0},{2,2,1,0},{4,4,1,0},{4,4,1,0},{2,2,1,0},{2,2,1,0},{4,4,1,0},{4,4,1,0},{8,8,1,0},{8,8,1,0}},
+	{{2,1,0,0},{2,1,0,0},{4,1,0,0},{4,1,0,0},{2,1,0,0},{2,1,0,0},{4,1,0,0},{4,1,0,0},{4,1,0,0},{4,1,0,0}},
+	{{2,2,0,0},{2,2,0,0},{4,2,0,0},{4,2,0,0},{2,2,0,0},{2,2,0,0},{4,2,0,0},{4,2,0,0},{4,2,0,0},{4,2,0,0}},
+	{{1,2,0,0},{1,2,0,0},{1,4,0,0},{1,4,0,0},{1,2,0,0},{1,2,0,0},{1,4,0,0},{1,4,0,0},{1,4,0,0},{1,4,0,0}},
+	{{2,2,0,0},{2,2,0,0},{2,4,0,0},{2,4,0,0},{2,2,0,0},{2,2,0,0},{2,4,0,0},{2,4,0,0},{2,4,0,0},{2,4,0,0}},
+	{{16,0,0,0},{16,0,0,0},{16,0,0,0},{16,0,0,0},{16,0,0,0},{16,0,0,0},{16,0,0,0},{16,0,0,0},{16,0,0,0},{16,0,0,0}},
+	{{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{2,2,0,0},{8,2,0,0},{8,2,0,0}},
+	{{2,2,0,0},{2,4,0,0},{4,2,0,0},{4,4,0,0},{2,4,0,0},{2,8,0,0},{4,4,0,0},{4,8,0,0},{8,4,0,0},{8,8,0,0}},
+	{{2,2,2,0},{2,2,2,0},{4,4,4,0},{4,4,4,0},{2,2,2,0},{2,2,2,0},{4,4,4,0},{4,4,4,0},{8,8,8,0},{8,8,8,0}},
+	{{2,0,0,0},{2,0,0,0},{4,0,0,0},{4,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0},{8,0,0,0}},
+	{{2,2,0,0},{2,4,0,0},{4,2,0,0},{4,4,0,0},{8,4,0,0},{8,8,0,0},{8,4,0,0},{8,8,0,0},{8,4,0,0},{8,8,0,0}},
+	{{10,0,0,0},{10,0,0,0},{10,0,0,0},{10,0,0,0},{10,0,0,0},{10,0,0,0},{10,0,0,0},{10,0,0,0},{10,0,0,0},{10,0,0,0}},
+	{{10,10,0,0},{10,10,0,0},{10,10,0,0},{10,10,0,0},{10,10,0,0},{10,10,0,0},{10,10,0,0},{10,10,0,0},{10,10,0,0},{10,10,0,0}}
+};
+
+const U2 crudasm_intel_argsize_index[] = {
+	0xf000,0xf000,0xf001,0xf001,0xf000,0xf000,0xf000,0xe002,0xe002,0xe003,0xe003,0xf002,0xf002,0xf003,0xf003,0xe002,
+	0xe003,0xe002,0xe002,0xe003,0xe003,0xf002,0xf002,0xf003,0xf003,0xe002,0xe003,0xe002,0xe002,0xe003,0xe003,0xf002,
+	0xf002,0xf003,0xf003,0xe002,0xe003,0xe002,0xe002,0xe003,0xe003,0xf002,0xf002,0xf003,0xf003,0xe002,0xe003,0xe002,
+	0xe002,0xe003,0xe003,0xf002,0xf002,0xf003,0xf003,0xe002,0xe003,0xe002,0xe002,0xe003,0xe003,0xf002,0xf002,0xf003,
+	0xf003,0xe002,0xe003,0xe002,0xe002,0xe003,0xe003,0xf002,0xf002,0xf003,0xf003,0xe002,0xe003,0xe002,0xe002,0xe003,
+	0xe003,0xf002,0xf002,0xf003,0xf003,0xe002,0xe003,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,
+	0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,
+	0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,
+	0xe004,0xe002,0xe004,0xe002,0xe004,0xe002,0xe004,0xe005,0xe005,0xf000,0xf006,0xf000,0xf000,0xf006,0xf006,0xf007,
+	0xf007,0xf000,0xf006,0xf000,0xf008,0xf009,0xf008,0xf009,0xf000,0xf000,0xf009,0xf009,0xf00a,0xf00a,0xf009,0xf009,
+	0xf008,0xf008,0xf00b,0xf00b,0xf009,0xf009,0xf001,0xf001,0xf002,0xf002,0xf003,0xf003,0xf002,0xf002,0xf003,0xf003,
+	0xe002,0xe003,0xe002,0xe003,0xe00c,0xe00d,0xd00e,0xd00f,0xf003,0xf010,0xe011,0xf000,0xf000,0xf000,0xf000,0xf000,
+	0xf000,0xf012,0xf012,0xf012,0xf012,0xe012,0xe013,0xf012,0xe012,0xe013,0xf012,0xe012,0xe013,0xf012,0xf012,0xf000,
+	0xf000,0xf000,0xf000,0xf000,0xf000,0xf000,0xf000,0xf001,0xc014,0xc00d,0xc014,0xc00d,0xf012,0xf007,0xf007,0xf007,
+	0xf007,0xf003,0xf003,0xf003,0xf003,0xf003,0xf003,0xf003,0xf00e,0xf000,0xf003,0xc003,0xc004,0xc003,0xc004,0xc003,
+	0xc004,0xc003,0xc004,0xe015,0xf002,0xf003,0xe016,0xe016,0xc004,0xc017,0xc004,0xc017,0xf018,0xf018,0xf018,0xf018,
+	0xf002,0xf003,0xf000,0xf000,0xc002,0xc019,0xc00c,0xc01a,0xc002,0xc01b,0xc00e,0xc01c,0xf003,0xf003,0xf003,0xf003,
+	0xf003,0xf003,0xf003,0xf003,0xf003,0xf003,0xf003,0xf003,0xf003,0xf003,0xf003,0xf003,0xf000,0xf01d,0xf01d,0xe013,
+	0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,0xe013,
+	0xf010,0xf010,0xf010,0xf010,0xf010,0xe00d,0xe00d,0xe00d,0xe00d,0xe00d,0xe00d,0xe01e,0xe01e,0xe01e,0xe01e,0xe01e,
+	0xe01e,0xf000,0xf000,0xf000,0xf000,0xf002,0xf003,0xf002,0xf003,0xf002,0xf003,0xf002,0xf003,0xf002,0xf003,0xf002,
+	0xf003,0xe002,0xe003,0xe002,0xe003,0xe002,0xe003,0xf002,0xf003,0xf003,0xe001,0xe013,0xe001,0xe013,0xe013,0xe001,
+	0xe013,0xe013,0xe001,0xe013,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,
+	0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,
+	0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,
+	0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,
+	0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,
+	0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,
+	0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,
+	0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,0xf001,
+	0xf001,0xf001,0xf001,0xf001,0xf001,0xe013,0xf000,0xf000,0xf000,0xf000,0xf000,0xf000,0xf000,0xf000,0xf000,0xf000,
+	0xc01f,0xf000,0xf020,0xf020,0xf003,0xf001,0xe013,0xf001,0xe013,0xf001,0xe013,0xf001,0xe013,0xf000,0xe021,0xe021,
+	0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,
+	0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,0xe021,
+	0xe00d,0xe021,0xe021,0xe021,0xe021,0xe00d,0xe021,0xf012,0xf012,0xf012,0xf012,0xf001,0xf001,0xf000,0xc022,0xc022,
+	0xc022,0xc022,0xf023,0xe00a,0xe006,0xe023,0xe00a,0xe006,0xe023,0xe023,0xf012,0xf012,0xe00a,0xe006,0xe023,0xe023,
+	0xe00a,0xe006,0xf024,0xf024,0xf024,0xe00a,0xe012,0xf000
+};
+
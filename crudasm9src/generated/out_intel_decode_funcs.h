@@ -0,0 +1,2367 @@
+// out_intel_decode_funcs.h  (note: this file was automatically generated -- do not edit!)
+// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.
+// Not a normal header: ixdecoder_mode.h includes it once per mode when CRUDASM_COMPILED_ARGS
+// is defined. Each function does what get_arguments() does for the encodings that use it.
+
+static int IXDEC_NAME(decode_args_0)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_void;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_1)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[0];
+	if(size == 8)
+		return crudasm_intel_status_missing_imm64_sx32;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_2)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[1];
+	if(size == 8)
+		return crudasm_intel_status_missing_imm64_sx32;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_3)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[1];
+	if(size == 8)
+		size = 4;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_4)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U1 immvalue;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	if(sizes[1] == 1)
+		return crudasm_intel_status_internal_error;
+	dest->sx = 1;
+	if(!fetch_byte(fetcher, &immvalue))
+		return crudasm_intel_status_limit_exceeded_8;
+	accept_byte(fetcher);
+	if(dest->osz == 0)
+		dest->imm = (U4)(U2)(S2)(S1)(immvalue);
+	else
+		dest->imm = (U4)(S4)(S1)(immvalue);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_5)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_6)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_7)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[1];
+	if(size == 8)
+		return crudasm_intel_status_missing_imm64_sx32;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_8)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[1];
+	if(size == 8)
+		size = 4;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_9)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_imm_implict;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 1;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->imm = 1;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_10)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 1;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_11)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_12)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_13)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_mmx;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_mmx;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_14)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_xmm;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_xmm;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_15)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_xmm;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_xmm;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_16)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_mem_fulldisp;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->has_disp = 1;
+	state->disp_offset = (U1)(fetcher->next_offset);
+	if(!fetch_le(fetcher, (U1)(2 << dest->asz), &value))
+		return crudasm_intel_status_limit_exceeded_7;
+	dest->disp = (U4)(value);
+	if(dest->asz == 2)
+		dest->imm = (U4)((value >> 16) >> 16);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_17)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+
+	dest->argtype[0] = crudasm_intel_argtype_mem_fulldisp;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 0;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->has_disp = 1;
+	state->disp_offset = (U1)(fetcher->next_offset);
+	if(!fetch_le(fetcher, (U1)(2 << dest->asz), &value))
+		return crudasm_intel_status_limit_exceeded_7;
+	dest->disp = (U4)(value);
+	if(dest->asz == 2)
+		dest->imm = (U4)((value >> 16) >> 16);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_18)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = (U1)(state->opcode0 & 7) + ((U1)(p->rex_b) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[1];
+	if(size == 8)
+		return crudasm_intel_status_missing_imm64_sx32;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_19)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_imm_both;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = (U1)(state->opcode0 & 7) + ((U1)(p->rex_b) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	if(sizes[1] == 8)
+	{
+		if(!fetch_le(fetcher, 8, &value))
+			return crudasm_intel_status_limit_exceeded_9;
+		dest->imm = (U4)(value);
+		dest->disp = (U4)((value >> 16) >> 16);
+		dest->imm64 = 1;
+	}
+	else
+	{
+		size = sizes[1];
+		if(size == 8)
+			return crudasm_intel_status_missing_imm64_sx32;
+		if(!fetch_le(fetcher, (U1)(size), &value))
+			return crudasm_intel_status_limit_exceeded_10;
+		dest->imm = (U4)(value);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_20)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_mem_implict_std;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 2;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_21)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 2;
+	dest->argtype[1] = crudasm_intel_argtype_mem_implict_sts;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_22)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_mem_ea_dbl;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_23)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_mem_ea_lim;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_24)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = (state->modrm0 & 7) + ((U1)(p->rex_b) << 3);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_25)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_26)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_mem_ea_eai;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_27)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_cr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_28)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_cr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_29)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_dr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_30)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_dr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_31)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_mem_ea_seg;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_32)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_imm_2nd;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[0];
+	if(size == 8)
+		return crudasm_intel_status_missing_imm64_sx32;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm2_offset = (U1)(fetcher->next_offset);
+	size = sizes[1];
+	if(size == 8)
+		return crudasm_intel_status_missing_imm64_sx32;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->disp = (U4)(value);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_33)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = (U1)(state->opcode0 & 7) + ((U1)(p->rex_b) << 3);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_34)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[2] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[2];
+	if(size == 8)
+		return crudasm_intel_status_missing_imm64_sx32;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_35)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = 1;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[2] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_36)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 2;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_37)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 0;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[0];
+	if(size == 8)
+		return crudasm_intel_status_missing_imm64_sx32;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_38)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 2;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 0;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_39)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_mem_ea_fxs;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_40)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_41)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 1;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_42)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 2;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_43)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 3;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_44)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 4;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_45)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 5;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_46)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[0];
+	if(size == 8)
+		size = 4;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_47)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U1 immvalue;
+
+	dest->argtype[0] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	if(sizes[0] == 1)
+		return crudasm_intel_status_internal_error;
+	dest->sx = 1;
+	if(!fetch_byte(fetcher, &immvalue))
+		return crudasm_intel_status_limit_exceeded_8;
+	accept_byte(fetcher);
+	if(dest->osz == 0)
+		dest->imm = (U4)(U2)(S2)(S1)(immvalue);
+	else
+		dest->imm = (U4)(S4)(S1)(immvalue);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_48)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_49)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 2;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_50)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 3;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_51)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 4;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_52)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 5;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_53)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 0;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_54)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 1;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_55)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 2;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_56)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 3;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_57)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 4;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_58)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[1] = crudasm_intel_argtype_reg_sr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 5;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[0] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[0] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_59)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_mem_implict_std;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_mem_implict_sts;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_60)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_mem_implict_sts;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_mem_implict_std;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_61)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_mem_implict_std;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 0;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_62)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_mem_implict_sts;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_63)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_mem_implict_std;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_64)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = (U1)(state->opcode0 & 7) + ((U1)(p->rex_b) << 3);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_65)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_mem_implict_xls;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_66)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_mem_ea_eal;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_67)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U8 value;
+	S2 size;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[2] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	size = sizes[2];
+	if(size == 8)
+		size = 4;
+	if(!fetch_le(fetcher, (U1)(size), &value))
+		return crudasm_intel_status_limit_exceeded_10;
+	dest->imm = (U4)(value);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_68)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U1 immvalue;
+
+	dest->argtype[0] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_reg_or_mem;
+	dest->argtype[2] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = ((state->modrm0 >> 3) & 7) + ((U1)(p->rex_r) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	if(state->modrm0 < 0xc0)
+		dest->argtype[1] = crudasm_intel_argtype_mem_ea;
+	else
+	{
+		dest->argvalue[1] = ((state->modrm0 >> 0) & 7) + ((U1)(p->rex_b) << 3);
+	}
+
+	if(sizes[2] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	if(sizes[2] == 1)
+		return crudasm_intel_status_internal_error;
+	dest->sx = 1;
+	if(!fetch_byte(fetcher, &immvalue))
+		return crudasm_intel_status_limit_exceeded_8;
+	accept_byte(fetcher);
+	if(dest->osz == 0)
+		dest->imm = (U4)(U2)(S2)(S1)(immvalue);
+	else
+		dest->imm = (U4)(S4)(S1)(immvalue);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_69)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_mem_ea_seg;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_70)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_imm_implict;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->imm = 0;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_71)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_imm_implict;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 3;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->imm = 3;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_72)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	U1 immvalue;
+
+	dest->argtype[0] = crudasm_intel_argtype_imm_1st;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_gr;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 1;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	state->imm1_offset = (U1)(fetcher->next_offset);
+	if(sizes[0] == 1)
+		return crudasm_intel_status_internal_error;
+	dest->sx = 1;
+	if(!fetch_byte(fetcher, &immvalue))
+		return crudasm_intel_status_limit_exceeded_8;
+	accept_byte(fetcher);
+	if(dest->osz == 0)
+		dest->imm = (U4)(U2)(S2)(S1)(immvalue);
+	else
+		dest->imm = (U4)(S4)(S1)(immvalue);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_73)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_st;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = (state->modrm0 & 7) + ((U1)(p->rex_b) << 3);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_74)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_st;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = 0;
+	dest->argtype[1] = crudasm_intel_argtype_reg_st;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = crudasm_intel_argvalue_default;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[1] = (state->modrm0 & 7) + ((U1)(p->rex_b) << 3);
+
+	return crudasm_intel_status_ok;
+}
+
+static int IXDEC_NAME(decode_args_75)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)
+{
+	dest->argtype[0] = crudasm_intel_argtype_reg_st;
+	dest->argsize[0] = sizes[0];
+	dest->argvalue[0] = crudasm_intel_argvalue_default;
+	dest->argtype[1] = crudasm_intel_argtype_reg_st;
+	dest->argsize[1] = sizes[1];
+	dest->argvalue[1] = 0;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argsize[2] = sizes[2];
+	dest->argvalue[2] = crudasm_intel_argvalue_default;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->argsize[3] = sizes[3];
+	dest->argvalue[3] = crudasm_intel_argvalue_default;
+
+	if(sizes[0] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+	dest->argvalue[0] = (state->modrm0 & 7) + ((U1)(p->rex_b) << 3);
+
+	if(sizes[1] <= 0)
+		return crudasm_intel_status_unsupported_argument;
+
+	return crudasm_intel_status_ok;
+}
+
+static const decode_args_func_t IXDEC_NAME(decode_args)[] = {
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_1), IXDEC_NAME(decode_args_1),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_2),
+	IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_3), IXDEC_NAME(decode_args_4), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_7),
+	IXDEC_NAME(decode_args_8), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_3),
+	IXDEC_NAME(decode_args_4), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_7), IXDEC_NAME(decode_args_8), IXDEC_NAME(decode_args_2),
+	IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_3), IXDEC_NAME(decode_args_4), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_7),
+	IXDEC_NAME(decode_args_8), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_3),
+	IXDEC_NAME(decode_args_4), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_7), IXDEC_NAME(decode_args_8), IXDEC_NAME(decode_args_2),
+	IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_3), IXDEC_NAME(decode_args_4), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_7),
+	IXDEC_NAME(decode_args_8), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_3),
+	IXDEC_NAME(decode_args_4), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_7), IXDEC_NAME(decode_args_8), IXDEC_NAME(decode_args_2),
+	IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_3), IXDEC_NAME(decode_args_4), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_7),
+	IXDEC_NAME(decode_args_8), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_3),
+	IXDEC_NAME(decode_args_4), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_7), IXDEC_NAME(decode_args_8), IXDEC_NAME(decode_args_2),
+	IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_10),
+	IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_9),
+	IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_2),
+	IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_10),
+	IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_9),
+	IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_2),
+	IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_10),
+	IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_9),
+	IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_2),
+	IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_10),
+	IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_9),
+	IXDEC_NAME(decode_args_9), IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_10), IXDEC_NAME(decode_args_11),
+	IXDEC_NAME(decode_args_11), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_13), IXDEC_NAME(decode_args_14), IXDEC_NAME(decode_args_13), IXDEC_NAME(decode_args_14),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_14), IXDEC_NAME(decode_args_15),
+	IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_14), IXDEC_NAME(decode_args_15),
+	IXDEC_NAME(decode_args_14), IXDEC_NAME(decode_args_15), IXDEC_NAME(decode_args_14), IXDEC_NAME(decode_args_15),
+	IXDEC_NAME(decode_args_14), IXDEC_NAME(decode_args_15), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_12),
+	IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6),
+	IXDEC_NAME(decode_args_16), IXDEC_NAME(decode_args_17), IXDEC_NAME(decode_args_16), IXDEC_NAME(decode_args_17),
+	IXDEC_NAME(decode_args_18), IXDEC_NAME(decode_args_19), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_3),
+	IXDEC_NAME(decode_args_20), IXDEC_NAME(decode_args_20), IXDEC_NAME(decode_args_21), IXDEC_NAME(decode_args_21),
+	IXDEC_NAME(decode_args_22), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_23), IXDEC_NAME(decode_args_23), IXDEC_NAME(decode_args_23),
+	IXDEC_NAME(decode_args_23), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_24), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_24), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_12),
+	IXDEC_NAME(decode_args_24), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_26),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_27), IXDEC_NAME(decode_args_28), IXDEC_NAME(decode_args_29),
+	IXDEC_NAME(decode_args_30), IXDEC_NAME(decode_args_31), IXDEC_NAME(decode_args_31), IXDEC_NAME(decode_args_31),
+	IXDEC_NAME(decode_args_31), IXDEC_NAME(decode_args_31), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6),
+	IXDEC_NAME(decode_args_32), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_33),
+	IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_12),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6),
+	IXDEC_NAME(decode_args_34), IXDEC_NAME(decode_args_35), IXDEC_NAME(decode_args_34), IXDEC_NAME(decode_args_35),
+	IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_7), IXDEC_NAME(decode_args_7), IXDEC_NAME(decode_args_36), IXDEC_NAME(decode_args_36),
+	IXDEC_NAME(decode_args_37), IXDEC_NAME(decode_args_37), IXDEC_NAME(decode_args_38), IXDEC_NAME(decode_args_38),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_6),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_39), IXDEC_NAME(decode_args_39), IXDEC_NAME(decode_args_40),
+	IXDEC_NAME(decode_args_41), IXDEC_NAME(decode_args_42), IXDEC_NAME(decode_args_43), IXDEC_NAME(decode_args_44),
+	IXDEC_NAME(decode_args_45), IXDEC_NAME(decode_args_40), IXDEC_NAME(decode_args_42), IXDEC_NAME(decode_args_43),
+	IXDEC_NAME(decode_args_44), IXDEC_NAME(decode_args_45), IXDEC_NAME(decode_args_33), IXDEC_NAME(decode_args_46),
+	IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_33), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_48), IXDEC_NAME(decode_args_49), IXDEC_NAME(decode_args_50), IXDEC_NAME(decode_args_51),
+	IXDEC_NAME(decode_args_52), IXDEC_NAME(decode_args_53), IXDEC_NAME(decode_args_54), IXDEC_NAME(decode_args_55),
+	IXDEC_NAME(decode_args_56), IXDEC_NAME(decode_args_57), IXDEC_NAME(decode_args_58), IXDEC_NAME(decode_args_53),
+	IXDEC_NAME(decode_args_54), IXDEC_NAME(decode_args_55), IXDEC_NAME(decode_args_56), IXDEC_NAME(decode_args_57),
+	IXDEC_NAME(decode_args_58), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_59), IXDEC_NAME(decode_args_59), IXDEC_NAME(decode_args_60),
+	IXDEC_NAME(decode_args_60), IXDEC_NAME(decode_args_61), IXDEC_NAME(decode_args_61), IXDEC_NAME(decode_args_62),
+	IXDEC_NAME(decode_args_62), IXDEC_NAME(decode_args_63), IXDEC_NAME(decode_args_63), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_7), IXDEC_NAME(decode_args_8), IXDEC_NAME(decode_args_2),
+	IXDEC_NAME(decode_args_3), IXDEC_NAME(decode_args_2), IXDEC_NAME(decode_args_3), IXDEC_NAME(decode_args_5),
+	IXDEC_NAME(decode_args_5), IXDEC_NAME(decode_args_64), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_33), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_33), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_65), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_0),
+	IXDEC_NAME(decode_args_66), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_67), IXDEC_NAME(decode_args_68),
+	IXDEC_NAME(decode_args_6), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46),
+	IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46), IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46),
+	IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46), IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46),
+	IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46), IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46),
+	IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46), IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46),
+	IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46), IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46),
+	IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46), IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46),
+	IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46), IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46),
+	IXDEC_NAME(decode_args_47), IXDEC_NAME(decode_args_46), IXDEC_NAME(decode_args_46), IXDEC_NAME(decode_args_25),
+	IXDEC_NAME(decode_args_32), IXDEC_NAME(decode_args_69), IXDEC_NAME(decode_args_46), IXDEC_NAME(decode_args_47),
+	IXDEC_NAME(decode_args_25), IXDEC_NAME(decode_args_32), IXDEC_NAME(decode_args_69), IXDEC_NAME(decode_args_1),
+	IXDEC_NAME(decode_args_70), IXDEC_NAME(decode_args_1), IXDEC_NAME(decode_args_70), IXDEC_NAME(decode_args_71),
+	IXDEC_NAME(decode_args_1), IXDEC_NAME(decode_args_0), IXDEC_NAME(decode_args_72), IXDEC_NAME(decode_args_72),
+	IXDEC_NAME(decode_args_72), IXDEC_NAME(decode_args_72), IXDEC_NAME(decode_args_73), IXDEC_NAME(decode_args_12),
+	IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_73), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_12),
+	IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_73), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_12),
+	IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_73),
+	IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_74), IXDEC_NAME(decode_args_75),
+	IXDEC_NAME(decode_args_75), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_12), IXDEC_NAME(decode_args_0)
+};
+
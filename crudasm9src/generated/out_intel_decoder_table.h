@@ -1,203 +1,336 @@
 // out_intel_decoder_table.h  (note: this file was automatically generated -- do not edit!)
 // Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.
 
-U4 crudasm_intel_decoder_table[] = {
-	0x1000b4a,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-	0x17,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-	0x18,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x21,0x21,0x21,0x21,0x21,0x21,0x21,
-	0x21,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
-	0x22,0xc5,0xcb,0xc7,0xdc,0xcd,0xce,0xffffff,0xffffff,0xc5,0xcb,0xc7,0xdc,0xcd,0xce,0xffffff,
-	0xffffff,0xc5,0xcb,0xc7,0xdc,0xcd,0xce,0xffffff,0xffffff,0xc6,0xcc,0xc7,0xdc,0xcd,0xce,0xffffff,
-	0xffffff,0xffffff,0x89,0x8b,0x8c,0x91,0xffffff,0xffffff,0xffffff,0xc1,0xc2,0xc3,0xc4,0xc8,0xffffff,0xca,
-	0xd7,0xc1,0xc2,0xc3,0xc4,0xc8,0xffffff,0xca,0xd7,0xc1,0xc2,0xc3,0xc4,0xc8,0xffffff,0xca,
-	0xd7,0x5000060,0xffffff,0xffffff,0xffffff,0xc9,0xffffff,0xca,0xffffff,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,
+CRUDASM_TABLE_ALIGN const U2 crudasm_intel_decoder_table[] = {
+	0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x15,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+	0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x16,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+	0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
+	0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xd,0xd,0xd,0xd,0xd,0xd,0xd,0xd,
+	0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,
+	0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,
+	0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,
+	0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x35,
+	0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,
+	0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,
+	0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,
+	0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x48,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,
+	0x51,0x51,0x51,0x51,0x51,0x51,0x51,0x51,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,
+	0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,
+	0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,
+	0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xb9,0xba,0x6120,0x6120,0x6120,0x6120,0x6120,0x6120,0x6120,0x6120,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,
+	0x1f2,0x1f2,0x1f3,0x1f3,0x1f3,0x1f3,0x1f3,0x1f3,0x1f3,0x1f3,0x11,0x1b,0x7,0x25,0x2f,0x39,
+	0x43,0x4d,0x13,0x1d,0x9,0x27,0x31,0x3b,0x45,0x4f,0x12,0x1c,0x8,0x26,0x30,0x3a,
+	0x44,0x4e,0x14,0x1e,0xa,0x28,0x32,0x3c,0x46,0x50,0x14f,0x14f,0x14f,0x14f,0x14f,0x14f,
+	0x14f,0x14f,0x150,0x150,0x150,0x150,0x150,0x150,0x150,0x150,0x157,0x157,0x157,0x157,0x157,0x157,
+	0x157,0x157,0x158,0x158,0x158,0x158,0x158,0x158,0x158,0x158,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,
+	0xa8,0xa8,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,
+	0xa9,0xa9,0xab,0xab,0xab,0xab,0xab,0xab,0xab,0xab,0x13b,0x13c,0x13d,0x13e,0x13f,0x140,
+	0xfff,0xfff,0x13b,0x13c,0x13d,0x13e,0x13f,0x140,0xfff,0xfff,0x13b,0x13c,0x13d,0x13e,0x13f,0x140,
+	0xfff,0xfff,0x135,0x136,0x137,0x138,0x139,0x13a,0xfff,0xfff,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,
+	0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,
+	0x1f0,0x1f0,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x130,0xfff,0x131,0x132,0x133,0x134,
+	0xfff,0xfff,0x12f,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x57,0x5d,0x63,0x69,0x6f,0x75,
+	0x7b,0x81,0x58,0x5e,0x64,0x6a,0x70,0x76,0x7c,0x82,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,
+	0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,
+	0xe1,0xe1,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,
+	0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,
+	0xe2,0xe2,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xb2,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xb3,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x59,0x5f,0x65,0x6b,0x71,0x77,
+	0x7d,0x83,0x5a,0x60,0x66,0x6c,0x72,0x78,0x7e,0x84,0x5b,0x61,0x67,0x6d,0x73,0x79,
+	0x7f,0x85,0x5c,0x62,0x68,0x6e,0x74,0x7a,0x80,0x86,0xfff,0x240,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0x240,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x240,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0x242,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x98,0xfff,0xfff,0xfff,0x93,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x99,0x23c,0xfff,0x233,0x236,0xfff,0x23b,
+	0xfff,0x23a,0x23c,0xfff,0x233,0x236,0xfff,0x23b,0xfff,0x23a,0x23c,0xfff,0x233,0x236,0xfff,0x23b,
+	0xfff,0x23a,0x23f,0x232,0xfff,0xfff,0xfff,0xfff,0x528a,0x5292,0xfff,0x245,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0x245,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x245,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x23e,
+	0xfff,0x238,0xfff,0xfff,0xfff,0xfff,0xfff,0x23e,0xfff,0x238,0xfff,0xfff,0xfff,0xfff,0xfff,0x23e,
+	0xfff,0x238,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x241,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0x241,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x241,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0x243,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x23d,0xfff,0x234,0x237,0xfff,0xfff,
+	0xfff,0xfff,0x23d,0xfff,0x234,0x237,0xfff,0xfff,0xfff,0xfff,0x23d,0xfff,0x234,0x237,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0x235,0x239,0xfff,0xfff,0xfff,0xfff,0xfff,0x246,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0x246,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x246,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0x244,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x153,0x155,0x15a,0x15c,0x1f7,0x1f5,
+	0x1f9,0x1fb,0x154,0x156,0x15b,0x15d,0x1f8,0x1f6,0x1fa,0x1fc,0x15f,0x162,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0x160,0x163,0x21f,0x221,0x224,0x226,0x12d,0xfff,0x160,0x163,0x21f,0x221,0x224,0x226,
+	0x12d,0xfff,0x160,0x163,0x21f,0x221,0x224,0x226,0x12d,0xfff,0x160,0x163,0x21f,0xfff,0x224,0xfff,
+	0x12d,0xfff,0xc5,0xcb,0xc7,0xdc,0xcd,0xce,0xfff,0xfff,0xc5,0xcb,0xc7,0xdc,0xcd,0xce,
+	0xfff,0xfff,0xc5,0xcb,0xc7,0xdc,0xcd,0xce,0xfff,0xfff,0xc6,0xcc,0xc7,0xdc,0xcd,0xce,
+	0xfff,0xfff,0xfff,0x89,0x8b,0x8c,0x91,0xfff,0xfff,0xfff,0xc1,0xc2,0xc3,0xc4,0xc8,0xfff,
+	0xca,0xd7,0xc1,0xc2,0xc3,0xc4,0xc8,0xfff,0xca,0xd7,0xc1,0xc2,0xc3,0xc4,0xc8,0xfff,
+	0xca,0xd7,0x53b2,0xfff,0xfff,0xfff,0xc9,0xfff,0xca,0xfff,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,
 	0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,0xd9,
-	0xd9,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,
+	0xd9,0xd9,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,
 	0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,
-	0xdb,0xda,0xda,0xda,0xda,0xda,0xda,0xda,0xda,0xa6,0xa7,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xa6,0xa7,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xa6,0xa7,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,
-	0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,
-	0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xffffff,0xffffff,0x40000e8,0x40000f0,0x40000f8,0x4000100,0xa1,
-	0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,0xa3,
-	0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xffffff,
-	0xffffff,0x400010e,0x4000116,0x400011e,0x4000126,0x1e5,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xde,0xde,0xde,0xde,0xde,0xde,0xde,0xde,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0x9a,0x9a,0x9a,
-	0x9a,0x9a,0x9a,0x9a,0x9a,0x9b,0x9b,0x9b,0x9b,0x9b,0x9b,0x9b,0x9b,0x94,0x94,0x94,
-	0x94,0x94,0x94,0x94,0x94,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x94,0x94,0x94,
-	0x94,0x94,0x94,0x94,0x94,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x94,0x94,0x94,
-	0x94,0x94,0x94,0x94,0x94,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x40001cc,0x40001d4,0x40001dc,
-	0x40001e4,0x40001ec,0x40001f4,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x97,0x97,0x97,0x97,0x97,
-	0x97,0x97,0x97,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x97,0x97,0x97,0x97,0x97,
-	0x97,0x97,0x97,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x97,0x97,0x97,0x97,0x97,
-	0x97,0x97,0x97,0x4000202,0x400020a,0x4000212,0x400021a,0x4000222,0x400022a,0x87,0x87,0x87,0x87,0x87,0x87,0x87,
-	0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,
-	0x87,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x87,0x87,0x87,0x87,0x87,0x87,0x87,
-	0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,
-	0x87,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x87,0x87,0x87,0x87,0x87,0x87,0x87,
+	0xdb,0xdb,0xda,0xda,0xda,0xda,0xda,0xda,0xda,0xda,0xa6,0xa7,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xa6,0xa7,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xa6,0xa7,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x1e5,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,
+	0xdd,0xdd,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,
+	0xdf,0xdf,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xde,0xde,0xde,0xde,0xde,0xde,
+	0xde,0xde,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,
+	0xe0,0xe0,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9a,0x9b,0x9b,0x9b,0x9b,0x9b,0x9b,
+	0x9b,0x9b,0x94,0x94,0x94,0x94,0x94,0x94,0x94,0x94,0x95,0x95,0x95,0x95,0x95,0x95,
+	0x95,0x95,0x44d2,0x44da,0x44d2,0x44da,0x44d2,0x44da,0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,
+	0x97,0x97,0x97,0x97,0x97,0x97,0x97,0x97,0x44e8,0x44f0,0x44e8,0x44f0,0x44e8,0x44f0,0x87,0x87,
 	0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,
-	0x87,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x3000238,0xffffff,0x3000258,0xffffff,0x3000278,0x88,
-	0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,
-	0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x88,
-	0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,
-	0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x88,
-	0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,
-	0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0x300029e,0xffffff,0x30002be,0xffffff,0x30002de,0xffffff,0x20001fc,0x2000232,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x2000298,0x20002fe,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x10c,0x10c,0x10c,0x10c,0x10c,0x10c,0x10c,0x10c,0x10d,0x10d,0x10d,
-	0x10d,0x10d,0x10d,0x10d,0x10d,0x10e,0x10e,0x10e,0x10e,0x10e,0x10e,0x10e,0x10e,0x10f,0x10f,0x10f,
-	0x10f,0x10f,0x10f,0x10f,0x10f,0x110,0x110,0x110,0x110,0x110,0x110,0x110,0x110,0x111,0x111,0x111,
-	0x111,0x111,0x111,0x111,0x111,0x112,0x112,0x112,0x112,0x112,0x112,0x112,0x112,0x113,0x113,0x113,
-	0x113,0x113,0x113,0x113,0x113,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x115,0x115,0x115,
-	0x115,0x115,0x115,0x115,0x115,0x116,0x116,0x116,0x116,0x116,0x116,0x116,0x116,0x117,0x117,0x117,
-	0x117,0x117,0x117,0x117,0x117,0x118,0x118,0x118,0x118,0x118,0x118,0x118,0x118,0x119,0x119,0x119,
-	0x119,0x119,0x119,0x119,0x119,0x11a,0x11a,0x11a,0x11a,0x11a,0x11a,0x11a,0x11a,0x11b,0x11b,0x11b,
-	0x11b,0x11b,0x11b,0x11b,0x11b,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0x9e,0x9e,0x9e,
-	0x9e,0x9e,0x9e,0x9e,0x9e,0xffffff,0x4000484,0xffffff,0xffffff,0x400048c,0xffffff,0x8f,0x8f,0x8f,0x8f,0x8f,
-	0x8f,0x8f,0x8f,0x400049a,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x90,0x90,0x90,0x90,0x90,0x90,0x90,
-	0x90,0x40004a8,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0x9f,
-	0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0xffffff,0x40004b6,0xffffff,0xffffff,0x40004be,0xffffff,0x165,0x166,0x167,
-	0x168,0x169,0x16a,0x16b,0x16c,0x16d,0x16e,0x16f,0x170,0x171,0x172,0x173,0x174,0x175,0x176,0x177,
-	0x178,0x179,0x17a,0x17b,0x17c,0x17d,0x17e,0x17f,0x180,0x181,0x182,0x183,0x184,0x185,0x186,0x187,
-	0x188,0x189,0x18a,0x18b,0x18c,0x18d,0x18e,0x18f,0x190,0x191,0x192,0x193,0x194,0x195,0x196,0x197,
-	0x198,0x199,0x19a,0x19b,0x19c,0x19d,0x19e,0x19f,0x1a0,0x1a1,0x1a2,0x1a3,0x1a4,0x1a5,0x1a6,0x1a7,
-	0x1a8,0x1a9,0x1aa,0x1ab,0x1ac,0x1ad,0x1ae,0x1af,0x1b0,0x1b1,0x1b2,0x1b3,0x1b4,0x1b5,0x1b6,0x1b7,
-	0x1b8,0x1b9,0x1ba,0x1bb,0x1bc,0x1bd,0x1be,0x1bf,0x1c0,0x1c1,0x1c2,0x1c3,0x1c4,0x1c5,0x1c6,0x1c7,
-	0x1c8,0x1c9,0x1ca,0x1cb,0x1cc,0x1cd,0x1ce,0x1cf,0x1d0,0x1d1,0x1d2,0x1d3,0x1d4,0x1d5,0x1d6,0x1d7,
-	0x1d8,0x1d9,0x1da,0x1db,0x1dc,0x1dd,0x1de,0x1df,0x1e0,0x1e1,0x1e2,0x1e3,0x1e4,0xea,0xea,0xea,
+	0x87,0x87,0x87,0x87,0x87,0x87,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x34fe,
+	0xfff,0x34fe,0xfff,0x34fe,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,
+	0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0x3524,0xfff,0x3524,0xfff,0x3524,0xfff,0x24e2,0x24f8,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x251e,0x2544,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x854a,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0x855a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x10c,0x10c,0x10c,0x10c,0x10c,0x10c,
+	0x10c,0x10c,0x10d,0x10d,0x10d,0x10d,0x10d,0x10d,0x10d,0x10d,0x10e,0x10e,0x10e,0x10e,0x10e,0x10e,
+	0x10e,0x10e,0x10f,0x10f,0x10f,0x10f,0x10f,0x10f,0x10f,0x10f,0x110,0x110,0x110,0x110,0x110,0x110,
+	0x110,0x110,0x111,0x111,0x111,0x111,0x111,0x111,0x111,0x111,0x112,0x112,0x112,0x112,0x112,0x112,
+	0x112,0x112,0x113,0x113,0x113,0x113,0x113,0x113,0x113,0x113,0x114,0x114,0x114,0x114,0x114,0x114,
+	0x114,0x114,0x115,0x115,0x115,0x115,0x115,0x115,0x115,0x115,0x116,0x116,0x116,0x116,0x116,0x116,
+	0x116,0x116,0x117,0x117,0x117,0x117,0x117,0x117,0x117,0x117,0x118,0x118,0x118,0x118,0x118,0x118,
+	0x118,0x118,0x119,0x119,0x119,0x119,0x119,0x119,0x119,0x119,0x11a,0x11a,0x11a,0x11a,0x11a,0x11a,
+	0x11a,0x11a,0x11b,0x11b,0x11b,0x11b,0x11b,0x11b,0x11b,0x11b,0x8f,0x8f,0x8f,0x8f,0x8f,0x8f,
+	0x8f,0x8f,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x165,0x166,0x167,0x168,0x169,0x16a,
+	0x16b,0x16c,0x16d,0x16e,0x16f,0x170,0x171,0x172,0x173,0x174,0x175,0x176,0x177,0x178,0x179,0x17a,
+	0x17b,0x17c,0x17d,0x17e,0x17f,0x180,0x181,0x182,0x183,0x184,0x185,0x186,0x187,0x188,0x189,0x18a,
+	0x18b,0x18c,0x18d,0x18e,0x18f,0x190,0x191,0x192,0x193,0x194,0x195,0x196,0x197,0x198,0x199,0x19a,
+	0x19b,0x19c,0x19d,0x19e,0x19f,0x1a0,0x1a1,0x1a2,0x1a3,0x1a4,0x1a5,0x1a6,0x1a7,0x1a8,0x1a9,0x1aa,
+	0x1ab,0x1ac,0x1ad,0x1ae,0x1af,0x1b0,0x1b1,0x1b2,0x1b3,0x1b4,0x1b5,0x1b6,0x1b7,0x1b8,0x1b9,0x1ba,
+	0x1bb,0x1bc,0x1bd,0x1be,0x1bf,0x1c0,0x1c1,0x1c2,0x1c3,0x1c4,0x1c5,0x1c6,0x1c7,0x1c8,0x1c9,0x1ca,
+	0x1cb,0x1cc,0x1cd,0x1ce,0x1cf,0x1d0,0x1d1,0x1d2,0x1d3,0x1d4,0x1d5,0x1d6,0x1d7,0x1d8,0x1d9,0x1da,
+	0x1db,0x1dc,0x1dd,0x1de,0x1df,0x1e0,0x1e1,0x1e2,0x1e3,0x1e4,0xea,0xea,0xea,0xea,0xea,0xea,
 	0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,
-	0xea,0xea,0xea,0xea,0xea,0xeb,0xeb,0xeb,0xeb,0xeb,0xeb,0xeb,0xeb,0xfc,0xfc,0xfc,
-	0xfc,0xfc,0xfc,0xfc,0xfc,0xfd,0xfd,0xfd,0xfd,0xfd,0xfd,0xfd,0xfd,0xed,0xed,0xed,
-	0xed,0xed,0xed,0xed,0xed,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0x11e,0x11d,0x9d,0x9c,0xffffff,0xffffff,0xffffff,0xffffff,0x11e,0x11d,0x9d,
-	0x9c,0xffffff,0xffffff,0xffffff,0xffffff,0x11e,0x11d,0x9d,0x9c,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x1f4,0x1f4,0x1f4,0x1f4,0x1f4,0x1f4,0x1f4,0x1f4,0xf4,0xf4,0xf4,
-	0xf4,0xf4,0xf4,0xf4,0xf4,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xe3,0xe3,0xe3,
+	0xea,0xea,0xeb,0xeb,0xeb,0xeb,0xeb,0xeb,0xeb,0xeb,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,
+	0xfc,0xfc,0xfd,0xfd,0xfd,0xfd,0xfd,0xfd,0xfd,0xfd,0xed,0xed,0xed,0xed,0xed,0xed,
+	0xed,0xed,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,
+	0xff,0xff,0x11e,0x11d,0x9d,0x9c,0xfff,0xfff,0xfff,0xfff,0x11e,0x11d,0x9d,0x9c,0xfff,0xfff,
+	0xfff,0xfff,0x11e,0x11d,0x9d,0x9c,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0x1f4,0x1f4,0x1f4,0x1f4,0x1f4,0x1f4,0x1f4,0x1f4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,
+	0xf4,0xf4,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,
 	0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,0xe3,
-	0xe3,0xe3,0xe3,0xe3,0xe3,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xef,0xef,0xef,
-	0xef,0xef,0xef,0xef,0xef,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,
-	0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,
-	0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf9,0xf9,0xf9,
-	0xf9,0xf9,0xf9,0xf9,0xf9,0xffffff,0xffffff,0xffffff,0xffffff,0xec,0xee,0xf0,0xf2,0xf1,0xf1,0xf1,
-	0xf1,0xf1,0xf1,0xf1,0xf1,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe7,0xe7,0xe7,
-	0xe7,0xe7,0xe7,0xe7,0xe7,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xfb,0xfb,
-	0xfb,0xfb,0xfb,0xfb,0xfb,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x101,0x101,0x101,
-	0x101,0x101,0x101,0x101,0x101,0xffffff,0xf6,0xffffff,0xffffff,0xffffff,0xffffff,0x8d,0x8e,0xffffff,0xf6,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x8d,0x8e,0xffffff,0xf6,0xffffff,0xffffff,0xffffff,0xffffff,0x8d,0x8e,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xf7,0xffffff,0xffffff,0xffffff,0xffffff,0x8a,0xffffff,0xffffff,0xf7,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x8a,0xffffff,0xffffff,0xf7,0xffffff,0xffffff,0xffffff,0xffffff,0x8a,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x92,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x92,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x92,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x3000684,0x30006a4,0xffffff,0xffffff,0x30006c4,0xffffff,0x3000040,0x3000068,0x3000088,0x30000a8,0xffffff,
-	0xbf,0xd4,0xc0,0xd6,0xcf,0xffffff,0xbc,0xffffff,0x30000c8,0xffffff,0xffffff,0x2000108,0x200012e,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x4000134,0x300013c,0x300015c,0x300017c,0x300019c,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x40001bc,0x40001c4,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xd0,0xd3,0xd1,0xd2,0xbd,
-	0xbe,0xffffff,0xffffff,0x1000304,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x4000404,0x400040c,0x4000414,0x400041c,0x4000424,
-	0x400042c,0x4000434,0x400043c,0x4000444,0x400044c,0x4000454,0x400045c,0x4000464,0x400046c,0x4000474,0x400047c,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x2000494,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0x11c,0x20004a2,0x20004b0,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x20004c6,0x1ff,0x201,0x203,0x205,0x207,
-	0x209,0x20b,0x20d,0x20f,0x211,0x213,0x215,0x217,0x219,0x21b,0x21d,0x40004cc,0x40004d4,0x40004dc,0x40004e4,0x40004ec,
-	0x40004f4,0x40004fc,0x4000504,0x400050c,0x4000514,0x400051c,0x4000524,0x400052c,0x4000534,0x400053c,0x4000544,0x123,0x128,0xd5,0x300054c,0x400056c,
-	0x4000574,0xffffff,0xffffff,0x124,0x129,0xbb,0x400057c,0x4000584,0x400058c,0x3000594,0x40005b4,0x40005bc,0x40005c4,0x30005cc,0x40005ec,0x30005f4,
-	0x3000614,0x4000634,0x400063c,0xffffff,0xffffff,0x4000644,0x400064c,0x4000654,0x400065c,0x4000664,0x400066c,0x4000674,0x400067c,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0x20006e4,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xb,0xb,0xb,0xb,0xb,
-	0xb,0xb,0xb,0xd,0xd,0xd,0xd,0xd,0xd,0xd,0xd,0xc,0xc,0xc,0xc,0xc,
-	0xc,0xc,0xc,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0xe,0x29,0x29,0x29,0x29,0x29,
-	0x29,0x29,0x29,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2a,0x2a,0x2a,0x2a,0x2a,
-	0x2a,0x2a,0x2a,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x2c,0x33,0x33,0x33,0x33,0x33,
-	0x33,0x33,0x33,0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x35,0x34,0x34,0x34,0x34,0x34,
-	0x34,0x34,0x34,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x3d,0x3d,0x3d,0x3d,0x3d,
-	0x3d,0x3d,0x3d,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3f,0x3e,0x3e,0x3e,0x3e,0x3e,
-	0x3e,0x3e,0x3e,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x47,0x47,0x47,0x47,0x47,
-	0x47,0x47,0x47,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x48,0x48,0x48,0x48,0x48,
-	0x48,0x48,0x48,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x51,0x51,0x51,0x51,0x51,
-	0x51,0x51,0x51,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x52,0x52,0x52,0x52,0x52,
-	0x52,0x52,0x52,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0x54,0xb8,0xb8,0xb8,0xb8,0xb8,
-	0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,0xb8,
-	0xb8,0xb8,0xb8,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xb9,0xba,0xb9,0xba,0xb9,
-	0xba,0xb9,0xba,0xb9,0xba,0xb9,0xba,0xb9,0xba,0xb9,0xba,0x60008ca,0x60008cc,0x60008ce,0x60008d0,0x60008d2,
-	0x60008d4,0x60008d6,0x60008d8,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f2,0x1f3,0x1f3,0x1f3,0x1f3,0x1f3,
-	0x1f3,0x1f3,0x1f3,0x11,0x1b,0x7,0x25,0x2f,0x39,0x43,0x4d,0x13,0x1d,0x9,0x27,0x31,
-	0x3b,0x45,0x4f,0x12,0x1c,0x8,0x26,0x30,0x3a,0x44,0x4e,0x14,0x1e,0xa,0x28,0x32,
-	0x3c,0x46,0x50,0x14f,0x14f,0x14f,0x14f,0x14f,0x14f,0x14f,0x14f,0x150,0x150,0x150,0x150,0x150,
-	0x150,0x150,0x150,0x157,0x157,0x157,0x157,0x157,0x157,0x157,0x157,0x158,0x158,0x158,0x158,0x158,
-	0x158,0x158,0x158,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xaa,0xaa,0xaa,0xaa,0xaa,
-	0xaa,0xaa,0xaa,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xab,0xab,0xab,0xab,0xab,
-	0xab,0xab,0xab,0x13b,0x13c,0x13d,0x13e,0x13f,0x140,0xffffff,0xffffff,0x13b,0x13c,0x13d,0x13e,0x13f,
-	0x140,0xffffff,0xffffff,0x13b,0x13c,0x13d,0x13e,0x13f,0x140,0xffffff,0xffffff,0x135,0x136,0x137,0x138,0x139,
-	0x13a,0xffffff,0xffffff,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,
-	0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0x1f0,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x130,0xffffff,0x131,0x132,0x133,0x134,0xffffff,0xffffff,0x12f,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x57,0x5d,0x63,0x69,0x6f,0x75,0x7b,0x81,0x58,0x5e,0x64,0x6a,0x70,
-	0x76,0x7c,0x82,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,
-	0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,
-	0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xe2,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xb2,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xb3,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x59,0x5f,0x65,0x6b,0x71,0x77,0x7d,0x83,0x5a,0x60,0x66,0x6c,0x72,
-	0x78,0x7e,0x84,0x5b,0x61,0x67,0x6d,0x73,0x79,0x7f,0x85,0x5c,0x62,0x68,0x6e,0x74,
-	0x7a,0x80,0x86,0xffffff,0x240,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x240,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0x240,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x242,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x98,0xffffff,0xffffff,0xffffff,0x93,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0x99,0x23c,0xffffff,0x233,0x236,0xffffff,0x23b,0xffffff,0x23a,0x23c,0xffffff,0x233,0x236,0xffffff,
-	0x23b,0xffffff,0x23a,0x23c,0xffffff,0x233,0x236,0xffffff,0x23b,0xffffff,0x23a,0x23f,0x232,0xffffff,0xffffff,0xffffff,
-	0xffffff,0x5000a42,0x5000a4a,0xffffff,0x245,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x245,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0x245,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x23e,0xffffff,0x238,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0x23e,0xffffff,0x238,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x23e,0xffffff,0x238,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0x241,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x241,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0x241,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x243,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x23d,0xffffff,0x234,0x237,0xffffff,0xffffff,0xffffff,0xffffff,0x23d,0xffffff,0x234,0x237,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x23d,0xffffff,0x234,0x237,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x235,0x239,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0x246,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x246,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0xffffff,0x246,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x244,0xffffff,0xffffff,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x153,0x155,0x15a,0x15c,0x1f7,0x1f5,0x1f9,0x1fb,0x154,0x156,0x15b,0x15d,0x1f8,
-	0x1f6,0x1fa,0x1fc,0x15f,0x162,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0xffffff,0x160,0x163,0x21f,0x221,0x224,
-	0x226,0x12d,0xffffff,0x160,0x163,0x21f,0x221,0x224,0x226,0x12d,0xffffff,0x160,0x163,0x21f,0x221,0x224,
-	0x226,0x12d,0xffffff,0x160,0x163,0x21f,0xffffff,0x224,0xffffff,0x12d,0xffffff,0x4000000,0x4000008,0x4000010,0x4000018,0x19,
-	0x1a,0x11f,0x125,0x4000020,0x4000028,0x4000030,0x4000038,0x23,0x24,0x120,0x10006ea,0x40007ea,0x40007f2,0x40007fa,0x4000802,0xf,
-	0x10,0x121,0x126,0x400080a,0x4000812,0x400081a,0x4000822,0x2d,0x2e,0x122,0x127,0x400082a,0x4000832,0x400083a,0x4000842,0x37,
-	0x38,0xffffff,0x6,0x400084a,0x4000852,0x400085a,0x4000862,0x41,0x42,0xffffff,0x5,0x400086a,0x4000872,0x400087a,0x4000882,0x4b,
-	0x4c,0xffffff,0x1,0x400088a,0x4000892,0x400089a,0x40008a2,0x55,0x56,0xffffff,0x4,0x15e,0x15e,0x15e,0x15e,0x15e,
-	0x15e,0x15e,0x15e,0x161,0x161,0x161,0x161,0x161,0x161,0x161,0x161,0x12a,0x12a,0x12a,0x12a,0x12a,
-	0x12a,0x12a,0x12a,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x141,0x142,0x30008aa,0x40008da,0xffffff,
-	0xffffff,0xffffff,0xffffff,0x12b,0x40008e2,0x12c,0x40008ea,0xb4,0xb5,0xb6,0xb7,0x1fe,0x200,0x202,0x204,0x206,
-	0x208,0x20a,0x20c,0x20e,0x210,0x212,0x214,0x216,0x218,0x21a,0x21c,0x40008f2,0x40008fa,0x4000902,0x400090a,0x4000912,
-	0x400091a,0x4000922,0x400092a,0x4000932,0x400093a,0x4000942,0x400094a,0x3000952,0x3000972,0x4000992,0x400099a,0x159,0x159,0x159,0x159,0x159,
-	0x159,0x159,0x159,0x1e7,0x1e8,0x220,0x247,0x143,0x144,0x1e9,0x1ea,0xac,0xae,0xad,0xaf,0x145,
-	0x146,0x147,0x148,0x151,0x152,0x149,0x14a,0x14b,0x14c,0x14d,0x14e,0xb0,0xb0,0xb0,0xb0,0xb0,
-	0xb0,0xb0,0xb0,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0x40009a2,0x40009aa,0x227,0x228,0x30009b2,
-	0x30009d2,0x40009f2,0x40009fa,0xe8,0xe9,0x229,0x22a,0x22b,0x22c,0x1f1,0x22d,0x4000a02,0x4000a0a,0x4000a12,0x4000a1a,0x3,
-	0x2,0x1e6,0x164,0x3000a22,0x3000a52,0x3000a72,0x3000a92,0x3000ab2,0x3000ad2,0x3000af2,0xffffff,0x22e,0x22f,0x230,0x231,0x104,
-	0x105,0x108,0x109,0x21e,0x222,0x225,0x223,0x106,0x107,0x10a,0x10b,0xffffff,0x1fd,0xffffff,0xffffff,0x0,
-	0x1eb,0x4000b12,0x4000b1a,0x1ec,0x1ed,0x102,0x103,0x1ee,0x1ef,0x4000b22,0x3000b2a
+	0xe3,0xe3,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xef,0xef,0xef,0xef,0xef,0xef,
+	0xef,0xef,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,
+	0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,
+	0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xe5,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,
+	0xf9,0xf9,0xfff,0xfff,0xfff,0xfff,0xec,0xee,0xf0,0xf2,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,
+	0xf1,0xf1,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,
+	0xe7,0xe7,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,
+	0xfb,0xfb,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x101,0x101,0x101,0x101,0x101,0x101,
+	0x101,0x101,0xfff,0xf6,0xfff,0xfff,0xfff,0xfff,0x8d,0x8e,0xfff,0xf6,0xfff,0xfff,0xfff,0xfff,
+	0x8d,0x8e,0xfff,0xf6,0xfff,0xfff,0xfff,0xfff,0x8d,0x8e,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa4,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,
+	0xa5,0xa5,0xfff,0xf7,0xfff,0xfff,0xfff,0xfff,0x8a,0xfff,0xfff,0xf7,0xfff,0xfff,0xfff,0xfff,
+	0x8a,0xfff,0xfff,0xf7,0xfff,0xfff,0xfff,0xfff,0x8a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa0,0xa1,0xa1,0xa1,0xa1,0xa1,0xa1,
+	0xa1,0xa1,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,
+	0xa3,0xa3,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9e,0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,
+	0x9f,0x9f,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x92,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x92,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x92,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff
+};
+
+CRUDASM_TABLE_ALIGN const U2 crudasm_intel_decoder_flat_table[] = {
+	0x4000,0x4008,0x4010,0x4018,0x19,0x1a,0x11f,0x125,0x4020,0x4028,0x4030,0x4038,0x23,0x24,0x120,0xfff,
+	0x4040,0x4048,0x4050,0x4058,0xf,0x10,0x121,0x126,0x4060,0x4068,0x4070,0x4078,0x2d,0x2e,0x122,0x127,
+	0x4080,0x4088,0x4090,0x4098,0x37,0x38,0xfff,0x6,0x40a0,0x40a8,0x40b0,0x40b8,0x41,0x42,0xfff,0x5,
+	0x40c0,0x40c8,0x40d0,0x40d8,0x4b,0x4c,0xfff,0x1,0x40e0,0x40e8,0x40f0,0x40f8,0x55,0x56,0xfff,0x4,
+	0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x161,0x161,0x161,0x161,0x161,0x161,0x161,0x161,
+	0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,
+	0x141,0x142,0x3100,0x4122,0xfff,0xfff,0xfff,0xfff,0x12b,0x412a,0x12c,0x4132,0xb4,0xb5,0xb6,0xb7,
+	0x1fe,0x200,0x202,0x204,0x206,0x208,0x20a,0x20c,0x20e,0x210,0x212,0x214,0x216,0x218,0x21a,0x21c,
+	0x413a,0x4142,0x414a,0x4152,0x415a,0x4162,0x416a,0x4172,0x417a,0x4182,0x418a,0x4192,0x319a,0x31ba,0x41da,0x41e2,
+	0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x1e7,0x1e8,0x220,0x247,0x143,0x144,0x1e9,0x1ea,
+	0xac,0xae,0xad,0xaf,0x145,0x146,0x147,0x148,0x151,0x152,0x149,0x14a,0x14b,0x14c,0x14d,0x14e,
+	0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,
+	0x41ea,0x41f2,0x227,0x228,0x31fa,0x321a,0x423a,0x4242,0xe8,0xe9,0x229,0x22a,0x22b,0x22c,0x1f1,0x22d,
+	0x424a,0x4252,0x425a,0x4262,0x3,0x2,0x1e6,0x164,0x326a,0x329a,0x32ba,0x32da,0x32fa,0x331a,0x333a,0xfff,
+	0x22e,0x22f,0x230,0x231,0x104,0x105,0x108,0x109,0x21e,0x222,0x225,0x223,0x106,0x107,0x10a,0x10b,
+	0xfff,0x1fd,0xfff,0xfff,0x0,0x1eb,0x435a,0x4362,0x1ec,0x1ed,0x102,0x103,0x1ee,0x1ef,0x436a,0x3372,
+	0x3392,0x33ba,0x33da,0x33fa,0xfff,0xbf,0xd4,0xc0,0xd6,0xcf,0xfff,0xbc,0xfff,0x341a,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x443a,
+	0x3442,0x3462,0x3482,0x34a2,0xfff,0xfff,0xfff,0xfff,0x44c2,0x44ca,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xd0,0xd3,0xd1,0xd2,0xbd,0xbe,0xfff,0xfff,0x156a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x457a,0x4582,0x458a,0x4592,0x459a,0x45a2,0x45aa,0x45b2,0x45ba,0x45c2,0x45ca,0x45d2,0x45da,0x45e2,0x45ea,0x45f2,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x11c,0x45fa,0x4602,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x1ff,0x201,0x203,0x205,0x207,0x209,0x20b,0x20d,0x20f,0x211,0x213,0x215,0x217,0x219,0x21b,0x21d,
+	0x460a,0x4612,0x461a,0x4622,0x462a,0x4632,0x463a,0x4642,0x464a,0x4652,0x465a,0x4662,0x466a,0x4672,0x467a,0x4682,
+	0x123,0x128,0xd5,0x368a,0x46aa,0x46b2,0xfff,0xfff,0x124,0x129,0xbb,0x46ba,0x46c2,0x46ca,0x36d2,0x46f2,
+	0x46fa,0x4702,0x370a,0x472a,0x3732,0x3752,0x4772,0x477a,0xfff,0xfff,0x4782,0x478a,0x4792,0x479a,0x47a2,0x47aa,
+	0x47b2,0x47ba,0xfff,0xfff,0xfff,0xfff,0xfff,0x37c2,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x4000,0x4008,0x4010,0x4018,0x19,0x1a,0x11f,0x125,0x4020,0x4028,0x4030,0x4038,0x23,0x24,0x120,0xfff,
+	0x4040,0x4048,0x4050,0x4058,0xf,0x10,0x121,0x126,0x4060,0x4068,0x4070,0x4078,0x2d,0x2e,0x122,0x127,
+	0x4080,0x4088,0x4090,0x4098,0x37,0x38,0xfff,0x6,0x40a0,0x40a8,0x40b0,0x40b8,0x41,0x42,0xfff,0x5,
+	0x40c0,0x40c8,0x40d0,0x40d8,0x4b,0x4c,0xfff,0x1,0x40e0,0x40e8,0x40f0,0x40f8,0x55,0x56,0xfff,0x4,
+	0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x161,0x161,0x161,0x161,0x161,0x161,0x161,0x161,
+	0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,
+	0x141,0x142,0x3100,0x4122,0xfff,0xfff,0xfff,0xfff,0x12b,0x412a,0x12c,0x4132,0xb4,0xb5,0xb6,0xb7,
+	0x1fe,0x200,0x202,0x204,0x206,0x208,0x20a,0x20c,0x20e,0x210,0x212,0x214,0x216,0x218,0x21a,0x21c,
+	0x413a,0x4142,0x414a,0x4152,0x415a,0x4162,0x416a,0x4172,0x417a,0x4182,0x418a,0x4192,0x319a,0x31ba,0x41da,0x41e2,
+	0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x1e7,0x1e8,0x220,0x247,0x143,0x144,0x1e9,0x1ea,
+	0xac,0xae,0xad,0xaf,0x145,0x146,0x147,0x148,0x151,0x152,0x149,0x14a,0x14b,0x14c,0x14d,0x14e,
+	0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,
+	0x41ea,0x41f2,0x227,0x228,0x31fa,0x321a,0x423a,0x4242,0xe8,0xe9,0x229,0x22a,0x22b,0x22c,0x1f1,0x22d,
+	0x424a,0x4252,0x425a,0x4262,0x3,0x2,0x1e6,0x164,0x326a,0x329a,0x32ba,0x32da,0x32fa,0x331a,0x333a,0xfff,
+	0x22e,0x22f,0x230,0x231,0x104,0x105,0x108,0x109,0x21e,0x222,0x225,0x223,0x106,0x107,0x10a,0x10b,
+	0xfff,0x1fd,0xfff,0xfff,0x0,0x1eb,0x435a,0x4362,0x1ec,0x1ed,0x102,0x103,0x1ee,0x1ef,0x436a,0x3372,
+	0x3392,0x33ba,0x33da,0x33fa,0xfff,0xbf,0xd4,0xc0,0xd6,0xcf,0xfff,0xbc,0xfff,0x341a,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x443a,
+	0x3442,0x3462,0x3482,0x34a2,0xfff,0xfff,0xfff,0xfff,0x44c2,0x44ca,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xd0,0xd3,0xd1,0xd2,0xbd,0xbe,0xfff,0xfff,0x156a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x457a,0x4582,0x458a,0x4592,0x459a,0x45a2,0x45aa,0x45b2,0x45ba,0x45c2,0x45ca,0x45d2,0x45da,0x45e2,0x45ea,0x45f2,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x47e2,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x11c,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x47ea,
+	0x1ff,0x201,0x203,0x205,0x207,0x209,0x20b,0x20d,0x20f,0x211,0x213,0x215,0x217,0x219,0x21b,0x21d,
+	0x460a,0x4612,0x461a,0x4622,0x462a,0x4632,0x463a,0x4642,0x464a,0x4652,0x465a,0x4662,0x466a,0x4672,0x467a,0x4682,
+	0x123,0x128,0xd5,0x368a,0x46aa,0x46b2,0xfff,0xfff,0x124,0x129,0xbb,0x46ba,0x46c2,0x46ca,0x36d2,0x46f2,
+	0x46fa,0x4702,0x370a,0x472a,0x3732,0x3752,0x4772,0x477a,0xfff,0xfff,0x4782,0x478a,0x4792,0x479a,0x47a2,0x47aa,
+	0x47b2,0x47ba,0xfff,0xfff,0xfff,0xfff,0xfff,0x37f2,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x4000,0x4008,0x4010,0x4018,0x19,0x1a,0x11f,0x125,0x4020,0x4028,0x4030,0x4038,0x23,0x24,0x120,0xfff,
+	0x4040,0x4048,0x4050,0x4058,0xf,0x10,0x121,0x126,0x4060,0x4068,0x4070,0x4078,0x2d,0x2e,0x122,0x127,
+	0x4080,0x4088,0x4090,0x4098,0x37,0x38,0xfff,0x6,0x40a0,0x40a8,0x40b0,0x40b8,0x41,0x42,0xfff,0x5,
+	0x40c0,0x40c8,0x40d0,0x40d8,0x4b,0x4c,0xfff,0x1,0x40e0,0x40e8,0x40f0,0x40f8,0x55,0x56,0xfff,0x4,
+	0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x161,0x161,0x161,0x161,0x161,0x161,0x161,0x161,
+	0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,
+	0x141,0x142,0x3100,0x4122,0xfff,0xfff,0xfff,0xfff,0x12b,0x412a,0x12c,0x4132,0xb4,0xb5,0xb6,0xb7,
+	0x1fe,0x200,0x202,0x204,0x206,0x208,0x20a,0x20c,0x20e,0x210,0x212,0x214,0x216,0x218,0x21a,0x21c,
+	0x413a,0x4142,0x414a,0x4152,0x415a,0x4162,0x416a,0x4172,0x417a,0x4182,0x418a,0x4192,0x319a,0x31ba,0x41da,0x41e2,
+	0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x1e7,0x1e8,0x220,0x247,0x143,0x144,0x1e9,0x1ea,
+	0xac,0xae,0xad,0xaf,0x145,0x146,0x147,0x148,0x151,0x152,0x149,0x14a,0x14b,0x14c,0x14d,0x14e,
+	0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,
+	0x41ea,0x41f2,0x227,0x228,0x31fa,0x321a,0x423a,0x4242,0xe8,0xe9,0x229,0x22a,0x22b,0x22c,0x1f1,0x22d,
+	0x424a,0x4252,0x425a,0x4262,0x3,0x2,0x1e6,0x164,0x326a,0x329a,0x32ba,0x32da,0x32fa,0x331a,0x333a,0xfff,
+	0x22e,0x22f,0x230,0x231,0x104,0x105,0x108,0x109,0x21e,0x222,0x225,0x223,0x106,0x107,0x10a,0x10b,
+	0xfff,0x1fd,0xfff,0xfff,0x0,0x1eb,0x435a,0x4362,0x1ec,0x1ed,0x102,0x103,0x1ee,0x1ef,0x436a,0x3372,
+	0x3392,0x33ba,0x33da,0x33fa,0xfff,0xbf,0xd4,0xc0,0xd6,0xcf,0xfff,0xbc,0xfff,0x341a,0xfff,0xfff,
+	0x4812,0x481a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x443a,
+	0x3442,0x3462,0x3482,0x34a2,0xfff,0xfff,0xfff,0xfff,0x44c2,0x44ca,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xd0,0xd3,0xd1,0xd2,0xbd,0xbe,0xfff,0xfff,0x156a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x457a,0x4582,0x458a,0x4592,0x459a,0x45a2,0x45aa,0x45b2,0x45ba,0x45c2,0x45ca,0x45d2,0x45da,0x45e2,0x45ea,0x45f2,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x11c,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x1ff,0x201,0x203,0x205,0x207,0x209,0x20b,0x20d,0x20f,0x211,0x213,0x215,0x217,0x219,0x21b,0x21d,
+	0x460a,0x4612,0x461a,0x4622,0x462a,0x4632,0x463a,0x4642,0x464a,0x4652,0x465a,0x4662,0x466a,0x4672,0x467a,0x4682,
+	0x123,0x128,0xd5,0x368a,0x46aa,0x46b2,0xfff,0xfff,0x124,0x129,0xbb,0x46ba,0x46c2,0x46ca,0x36d2,0x46f2,
+	0x46fa,0x4702,0x370a,0x472a,0x3732,0x3752,0x4772,0x477a,0xfff,0xfff,0x4782,0x478a,0x4792,0x479a,0x47a2,0x47aa,
+	0x47b2,0x47ba,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x4000,0x4008,0x4010,0x4018,0x19,0x1a,0x11f,0x125,0x4020,0x4028,0x4030,0x4038,0x23,0x24,0x120,0xfff,
+	0x4040,0x4048,0x4050,0x4058,0xf,0x10,0x121,0x126,0x4060,0x4068,0x4070,0x4078,0x2d,0x2e,0x122,0x127,
+	0x4080,0x4088,0x4090,0x4098,0x37,0x38,0xfff,0x6,0x40a0,0x40a8,0x40b0,0x40b8,0x41,0x42,0xfff,0x5,
+	0x40c0,0x40c8,0x40d0,0x40d8,0x4b,0x4c,0xfff,0x1,0x40e0,0x40e8,0x40f0,0x40f8,0x55,0x56,0xfff,0x4,
+	0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x161,0x161,0x161,0x161,0x161,0x161,0x161,0x161,
+	0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,
+	0x141,0x142,0x3100,0x4122,0xfff,0xfff,0xfff,0xfff,0x12b,0x412a,0x12c,0x4132,0xb4,0xb5,0xb6,0xb7,
+	0x1fe,0x200,0x202,0x204,0x206,0x208,0x20a,0x20c,0x20e,0x210,0x212,0x214,0x216,0x218,0x21a,0x21c,
+	0x413a,0x4142,0x414a,0x4152,0x415a,0x4162,0x416a,0x4172,0x417a,0x4182,0x418a,0x4192,0x319a,0x31ba,0x41da,0x41e2,
+	0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x1e7,0x1e8,0x220,0x247,0x143,0x144,0x1e9,0x1ea,
+	0xac,0xae,0xad,0xaf,0x145,0x146,0x147,0x148,0x151,0x152,0x149,0x14a,0x14b,0x14c,0x14d,0x14e,
+	0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,
+	0x41ea,0x41f2,0x227,0x228,0x31fa,0x321a,0x423a,0x4242,0xe8,0xe9,0x229,0x22a,0x22b,0x22c,0x1f1,0x22d,
+	0x424a,0x4252,0x425a,0x4262,0x3,0x2,0x1e6,0x164,0x326a,0x329a,0x32ba,0x32da,0x32fa,0x331a,0x333a,0xfff,
+	0x22e,0x22f,0x230,0x231,0x104,0x105,0x108,0x109,0x21e,0x222,0x225,0x223,0x106,0x107,0x10a,0x10b,
+	0xfff,0x1fd,0xfff,0xfff,0x0,0x1eb,0x435a,0x4362,0x1ec,0x1ed,0x102,0x103,0x1ee,0x1ef,0x436a,0x3372,
+	0x3392,0x33ba,0x33da,0x33fa,0xfff,0xbf,0xd4,0xc0,0xd6,0xcf,0xfff,0xbc,0xfff,0x341a,0xfff,0xfff,
+	0x4812,0x481a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x443a,
+	0x3442,0x3462,0x3482,0x34a2,0xfff,0xfff,0xfff,0xfff,0x44c2,0x44ca,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xd0,0xd3,0xd1,0xd2,0xbd,0xbe,0xfff,0xfff,0x156a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x457a,0x4582,0x458a,0x4592,0x459a,0x45a2,0x45aa,0x45b2,0x45ba,0x45c2,0x45ca,0x45d2,0x45da,0x45e2,0x45ea,0x45f2,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x11c,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x1ff,0x201,0x203,0x205,0x207,0x209,0x20b,0x20d,0x20f,0x211,0x213,0x215,0x217,0x219,0x21b,0x21d,
+	0x460a,0x4612,0x461a,0x4622,0x462a,0x4632,0x463a,0x4642,0x464a,0x4652,0x465a,0x4662,0x466a,0x4672,0x467a,0x4682,
+	0x123,0x128,0xd5,0x368a,0x46aa,0x46b2,0xfff,0xfff,0x124,0x129,0xbb,0x46ba,0x46c2,0x46ca,0x36d2,0x46f2,
+	0x46fa,0x4702,0x370a,0x472a,0x3732,0x3752,0x4772,0x477a,0xfff,0xfff,0x4782,0x478a,0x4792,0x479a,0x47a2,0x47aa,
+	0x47b2,0x47ba,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x4000,0x4008,0x4010,0x4018,0x19,0x1a,0x11f,0x125,0x4020,0x4028,0x4030,0x4038,0x23,0x24,0x120,0xfff,
+	0x4040,0x4048,0x4050,0x4058,0xf,0x10,0x121,0x126,0x4060,0x4068,0x4070,0x4078,0x2d,0x2e,0x122,0x127,
+	0x4080,0x4088,0x4090,0x4098,0x37,0x38,0xfff,0x6,0x40a0,0x40a8,0x40b0,0x40b8,0x41,0x42,0xfff,0x5,
+	0x40c0,0x40c8,0x40d0,0x40d8,0x4b,0x4c,0xfff,0x1,0x40e0,0x40e8,0x40f0,0x40f8,0x55,0x56,0xfff,0x4,
+	0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x161,0x161,0x161,0x161,0x161,0x161,0x161,0x161,
+	0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,
+	0x141,0x142,0x3100,0x4122,0xfff,0xfff,0xfff,0xfff,0x12b,0x412a,0x12c,0x4132,0xb4,0xb5,0xb6,0xb7,
+	0x1fe,0x200,0x202,0x204,0x206,0x208,0x20a,0x20c,0x20e,0x210,0x212,0x214,0x216,0x218,0x21a,0x21c,
+	0x413a,0x4142,0x414a,0x4152,0x415a,0x4162,0x416a,0x4172,0x417a,0x4182,0x418a,0x4192,0x319a,0x31ba,0x41da,0x41e2,
+	0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x1e7,0x1e8,0x220,0x247,0x143,0x144,0x1e9,0x1ea,
+	0xac,0xae,0xad,0xaf,0x145,0x146,0x147,0x148,0x151,0x152,0x149,0x14a,0x14b,0x14c,0x14d,0x14e,
+	0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,
+	0x41ea,0x41f2,0x227,0x228,0x31fa,0x321a,0x423a,0x4242,0xe8,0xe9,0x229,0x22a,0x22b,0x22c,0x1f1,0x22d,
+	0x424a,0x4252,0x425a,0x4262,0x3,0x2,0x1e6,0x164,0x326a,0x329a,0x32ba,0x32da,0x32fa,0x331a,0x333a,0xfff,
+	0x22e,0x22f,0x230,0x231,0x104,0x105,0x108,0x109,0x21e,0x222,0x225,0x223,0x106,0x107,0x10a,0x10b,
+	0xfff,0x1fd,0xfff,0xfff,0x0,0x1eb,0x435a,0x4362,0x1ec,0x1ed,0x102,0x103,0x1ee,0x1ef,0x436a,0x3372,
+	0x3392,0x33ba,0x33da,0x33fa,0xfff,0xbf,0xd4,0xc0,0xd6,0xcf,0xfff,0xbc,0xfff,0x341a,0xfff,0xfff,
+	0x4822,0x482a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x443a,
+	0x3442,0x3462,0x3482,0x34a2,0xfff,0xfff,0xfff,0xfff,0x44c2,0x44ca,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xd0,0xd3,0xd1,0xd2,0xbd,0xbe,0xfff,0xfff,0x156a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x457a,0x4582,0x458a,0x4592,0x459a,0x45a2,0x45aa,0x45b2,0x45ba,0x45c2,0x45ca,0x45d2,0x45da,0x45e2,0x45ea,0x45f2,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x4832,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x11c,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x483a,
+	0x1ff,0x201,0x203,0x205,0x207,0x209,0x20b,0x20d,0x20f,0x211,0x213,0x215,0x217,0x219,0x21b,0x21d,
+	0x460a,0x4612,0x461a,0x4622,0x462a,0x4632,0x463a,0x4642,0x464a,0x4652,0x465a,0x4662,0x466a,0x4672,0x467a,0x4682,
+	0x123,0x128,0xd5,0x368a,0x46aa,0x46b2,0xfff,0xfff,0x124,0x129,0xbb,0x46ba,0x46c2,0x46ca,0x36d2,0x46f2,
+	0x46fa,0x4702,0x370a,0x472a,0x3732,0x3752,0x4772,0x477a,0xfff,0xfff,0x4782,0x478a,0x4792,0x479a,0x47a2,0x47aa,
+	0x47b2,0x47ba,0xfff,0xfff,0xfff,0xfff,0xfff,0x3842,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x4000,0x4008,0x4010,0x4018,0x19,0x1a,0x11f,0x125,0x4020,0x4028,0x4030,0x4038,0x23,0x24,0x120,0xfff,
+	0x4040,0x4048,0x4050,0x4058,0xf,0x10,0x121,0x126,0x4060,0x4068,0x4070,0x4078,0x2d,0x2e,0x122,0x127,
+	0x4080,0x4088,0x4090,0x4098,0x37,0x38,0xfff,0x6,0x40a0,0x40a8,0x40b0,0x40b8,0x41,0x42,0xfff,0x5,
+	0x40c0,0x40c8,0x40d0,0x40d8,0x4b,0x4c,0xfff,0x1,0x40e0,0x40e8,0x40f0,0x40f8,0x55,0x56,0xfff,0x4,
+	0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x15e,0x161,0x161,0x161,0x161,0x161,0x161,0x161,0x161,
+	0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12a,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,0x12e,
+	0x141,0x142,0x3100,0x4122,0xfff,0xfff,0xfff,0xfff,0x12b,0x412a,0x12c,0x4132,0xb4,0xb5,0xb6,0xb7,
+	0x1fe,0x200,0x202,0x204,0x206,0x208,0x20a,0x20c,0x20e,0x210,0x212,0x214,0x216,0x218,0x21a,0x21c,
+	0x413a,0x4142,0x414a,0x4152,0x415a,0x4162,0x416a,0x4172,0x417a,0x4182,0x418a,0x4192,0x319a,0x31ba,0x41da,0x41e2,
+	0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x159,0x1e7,0x1e8,0x220,0x247,0x143,0x144,0x1e9,0x1ea,
+	0xac,0xae,0xad,0xaf,0x145,0x146,0x147,0x148,0x151,0x152,0x149,0x14a,0x14b,0x14c,0x14d,0x14e,
+	0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb0,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,
+	0x41ea,0x41f2,0x227,0x228,0x31fa,0x321a,0x423a,0x4242,0xe8,0xe9,0x229,0x22a,0x22b,0x22c,0x1f1,0x22d,
+	0x424a,0x4252,0x425a,0x4262,0x3,0x2,0x1e6,0x164,0x326a,0x329a,0x32ba,0x32da,0x32fa,0x331a,0x333a,0xfff,
+	0x22e,0x22f,0x230,0x231,0x104,0x105,0x108,0x109,0x21e,0x222,0x225,0x223,0x106,0x107,0x10a,0x10b,
+	0xfff,0x1fd,0xfff,0xfff,0x0,0x1eb,0x435a,0x4362,0x1ec,0x1ed,0x102,0x103,0x1ee,0x1ef,0x436a,0x3372,
+	0x3392,0x33ba,0x33da,0x33fa,0xfff,0xbf,0xd4,0xc0,0xd6,0xcf,0xfff,0xbc,0xfff,0x341a,0xfff,0xfff,
+	0x4822,0x482a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x443a,
+	0x3442,0x3462,0x3482,0x34a2,0xfff,0xfff,0xfff,0xfff,0x44c2,0x44ca,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xd0,0xd3,0xd1,0xd2,0xbd,0xbe,0xfff,0xfff,0x156a,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x457a,0x4582,0x458a,0x4592,0x459a,0x45a2,0x45aa,0x45b2,0x45ba,0x45c2,0x45ca,0x45d2,0x45da,0x45e2,0x45ea,0x45f2,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0x11c,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0x1ff,0x201,0x203,0x205,0x207,0x209,0x20b,0x20d,0x20f,0x211,0x213,0x215,0x217,0x219,0x21b,0x21d,
+	0x460a,0x4612,0x461a,0x4622,0x462a,0x4632,0x463a,0x4642,0x464a,0x4652,0x465a,0x4662,0x466a,0x4672,0x467a,0x4682,
+	0x123,0x128,0xd5,0x368a,0x46aa,0x46b2,0xfff,0xfff,0x124,0x129,0xbb,0x46ba,0x46c2,0x46ca,0x36d2,0x46f2,
+	0x46fa,0x4702,0x370a,0x472a,0x3732,0x3752,0x4772,0x477a,0xfff,0xfff,0x4782,0x478a,0x4792,0x479a,0x47a2,0x47aa,
+	0x47b2,0x47ba,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,0xf3,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,
+	0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff,0xfff
 };
 
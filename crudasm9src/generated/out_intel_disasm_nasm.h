@@ -9,13 +9,13 @@ static int crudasm_intel_disasm_special_nasm(struct crudasm_intel_disasm_context
 			return intel_nasm_insn__aam(context);
 		case crudasm_intel_insn__bt_mem_reg:
 			{
-				ixdis1_write(context, "bt");
+				ixdis2_write_n(context, "bt", 2);
 				ixdis0_write_any_args(context);
 				return 1;	// handled
 			}
 		case crudasm_intel_insn__bt_other:
 			{
-				ixdis1_write(context, "bt");
+				ixdis2_write_n(context, "bt", 2);
 				ixdis0_write_any_args(context);
 				return 1;	// handled
 			}
@@ -2,6 +2,14 @@
 // Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.
 
 enum { CRUDASM_MAX_ASM_ARGS = 4 };
+enum { CRUDASM_ARGSIZE_COMBOS = 10 };	// (dsz, osz, asz) combinations in crudasm_intel_argsize_rows[]
+
+// The tables the decoder reads start on a cache line.
+#ifdef _MSC_VER
+#define CRUDASM_TABLE_ALIGN __declspec(align(64))
+#else
+#define CRUDASM_TABLE_ALIGN __attribute__((aligned(64)))
+#endif
 
 struct crudasm_intel_encoding_t {
 	U4 insn : 30;	// instruction number (index)
@@ -19,13 +27,36 @@ struct crudasm_intel_encoding_t {
 	U4 etags;	// encoding tags
 };
 
+// The decoder's part of crudasm_intel_encoding_table[] and crudasm_intel_insns[], 16 bytes
+// per encoding in a 64 byte aligned table. The full records are for the assembler and for
+// anything that needs the opcode bytes.
+struct crudasm_intel_encoding_hot_t {
+	U1 argtype[CRUDASM_MAX_ASM_ARGS];	// as in crudasm_intel_encoding_t
+	U1 argvalue[CRUDASM_MAX_ASM_ARGS];	// as in crudasm_intel_encoding_t
+	U2 insn;	// instruction number (index)
+	U2 etags;	// encoding tags
+	U2 argsize_index;	// same as crudasm_intel_argsize_index[]
+	U1 itags;	// instruction tags
+	U1 has_modrm;	// regop != f
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-extern struct crudasm_intel_encoding_t crudasm_intel_encoding_table[];  /* see out_intel_encoding_table.h */
+extern const struct crudasm_intel_encoding_t crudasm_intel_encoding_table[];  /* see out_intel_encoding_table.h */
+extern const struct crudasm_intel_encoding_hot_t crudasm_intel_encoding_hot_table[];  /* see out_intel_hot_table.h */
+
+extern const U2 crudasm_intel_decoder_table[];  /* see out_intel_decoder_table.h */
+extern const U2 crudasm_intel_decoder_flat_table[];  /* see out_intel_decoder_table.h; [6 * 512] */
+
+extern const U4 crudasm_intel_length_table[];  /* see out_intel_length_table.h */
+extern const U4 crudasm_intel_length_opcode_table[];  /* see out_intel_length_table.h */
+
+extern const U2 crudasm_intel_control_table[];  /* see out_intel_control_table.h */
 
-extern U4 crudasm_intel_decoder_table[];  /* see out_intel_decoder_table.h */
+extern const S1 crudasm_intel_argsize_rows[][CRUDASM_ARGSIZE_COMBOS][CRUDASM_MAX_ASM_ARGS];  /* see out_intel_argsize_table.h */
+extern const U2 crudasm_intel_argsize_index[];  /* see out_intel_argsize_table.h */
 
 #ifdef __cplusplus
 }
@@ -302,6 +333,59 @@ enum {
 	crudasm_intel_itagcount = 6
 };
 
+// crudasm_intel_decoder_table[] and crudasm_intel_decoder_flat_table[] entries: the node type
+// is in the high 4 bits, and the low 12 bits hold the node's offset in crudasm_intel_decoder_table[]
+// (for type 0, the encoding number, or crudasm_intel_decoder_invalid).
+enum {
+	crudasm_intel_decoder_type_shift = 12,
+	crudasm_intel_decoder_offset = 0xfff,
+	crudasm_intel_decoder_invalid = 0xfff
+};
+
+// crudasm_intel_length_table[] entries: the low 24 bits hold the number of immediate
+// bytes (0xf = invalid) in 6 nibbles: o16, o32 in 16/32 bit mode, then (66 + 2*rex.w)
+// in 64 bit mode. The high 8 bits are flags. crudasm_intel_length_opcode_table[] has the
+// same kind of entries for opcodes 00..ff and 0f 00..0f ff, where the opcode alone decides.
+enum {
+	crudasm_intel_length_modrm = 0x1000000,
+	crudasm_intel_length_no64 = 0x2000000,
+	crudasm_intel_length_fulldisp = 0x4000000,
+	crudasm_intel_length_lock_mem = 0x8000000,
+	crudasm_intel_length_lock_rm = 0x10000000,
+	crudasm_intel_length_sreg = 0x20000000,
+	crudasm_intel_length_fwaitable = 0x40000000,
+	crudasm_intel_length_tree = 0x80000000	// crudasm_intel_length_opcode_table[] only
+};
+
+// crudasm_intel_control_table[] entries, one per encoding: the low 4 bits hold the kind of
+// control transfer (crudasm_intel_control_none if the encoding just goes on to the next
+// instruction), and the rest are flags.
+enum {
+	crudasm_intel_control_none = 0x0,
+	crudasm_intel_control_jcc = 0x1,
+	crudasm_intel_control_jmp = 0x2,
+	crudasm_intel_control_call = 0x3,
+	crudasm_intel_control_ret = 0x4,
+	crudasm_intel_control_loop = 0x5,	// loop, loopz, loopnz, jcxz
+	crudasm_intel_control_int = 0x6,	// software interrupts and system calls
+	crudasm_intel_control_halt = 0x7,	// hlt, ud2
+	crudasm_intel_control_kind = 0xf,	// mask for the above
+	crudasm_intel_control_relative = 0x10,	// target is relative to the next instruction
+	crudasm_intel_control_far = 0x20,	// changes cs
+	crudasm_intel_control_indirect = 0x40,	// target comes from a register or memory
+	crudasm_intel_control_terminal = 0x80,	// never goes on to the next instruction
+	crudasm_intel_control_rel8 = 0x100,	// relative target is a sign-extended byte
+	crudasm_intel_control_rel_osz = 0x200	// relative target is operand-sized (32 bits in 64 bit mode)
+};
+
+// crudasm_intel_argsize_index[] entries, one per encoding: the low 12 bits select a row of
+// crudasm_intel_argsize_rows[], which has the argument sizes resolved for each (dsz, osz, asz).
+// Bit (12 + n) is set if the size of argument n goes without saying when disassembling.
+enum {
+	crudasm_intel_argsize_row = 0xfff,
+	crudasm_intel_argsize_implied = 0x1000	// << argument number
+};
+
 struct crudasm_intel_insn_t {
 	const char *alias;
 	U4 itags;	// instruction tags
@@ -312,12 +396,22 @@ struct crudasm_intel_insn_t {
 	S1 argSizes[CRUDASM_MAX_ASM_ARGS];
 };
 
+// Text the disassembler writes, with its length worked out in advance. text is padded with '\0'
+// but needn't end with one.
+struct crudasm_intel_token_t {
+	U1 length;
+	char text[15];
+};
+
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-extern struct crudasm_intel_insn_t crudasm_intel_insns[];  /* see out_intel_encoding_table.h */
+extern const struct crudasm_intel_insn_t crudasm_intel_insns[];  /* see out_intel_encoding_table.h */
+
+extern const struct crudasm_intel_token_t crudasm_intel_insn_tokens[];  /* see out_intel_token_table.h; alias of each crudasm_intel_insns[] entry */
+extern const struct crudasm_intel_token_t crudasm_intel_tokens[];  /* see out_intel_token_table.h */
 
 #ifdef __cplusplus
 }
@@ -332,3 +426,85 @@ enum {
 	crudasm_intel_modecount
 };
 
+// crudasm_intel_tokens[] indices. Register groups are indexed by register number.
+enum {
+	crudasm_intel_token_reg8 = 0,
+	crudasm_intel_token_reg8x86 = 20,
+	crudasm_intel_token_reg16 = 28,
+	crudasm_intel_token_reg32 = 44,
+	crudasm_intel_token_reg64 = 60,
+	crudasm_intel_token_sreg = 76,
+	crudasm_intel_token_byte = 84,
+	crudasm_intel_token_word = 85,
+	crudasm_intel_token_dword = 86,
+	crudasm_intel_token_qword = 87,
+	crudasm_intel_token_xword = 88,
+	crudasm_intel_token_tword = 89,
+	crudasm_intel_token_lock = 90,
+	crudasm_intel_token_rep = 91,
+	crudasm_intel_token_repnz = 92,
+	crudasm_intel_token_repz = 93,
+	crudasm_intel_token_o16 = 94,
+	crudasm_intel_token_o32 = 95,
+	crudasm_intel_token_o64 = 96,
+	crudasm_intel_token_xmm = 97,
+	crudasm_intel_token_mmx = 113,
+	crudasm_intel_token_cr = 129,
+	crudasm_intel_token_dr = 145,
+	crudasm_intel_token_st = 161,
+	crudasm_intel_token_short = 177,
+	crudasm_intel_token_near = 178,
+	crudasm_intel_token_far = 179,
+	crudasm_intel_token_rel = 180,
+	crudasm_intel_token_section_plus = 181,
+	crudasm_intel_token_aad = 182,
+	crudasm_intel_token_aam = 183,
+	crudasm_intel_token_call = 184,
+	crudasm_intel_token_cmps = 185,
+	crudasm_intel_token_cmpxchg = 186,
+	crudasm_intel_token_div = 187,
+	crudasm_intel_token_fmul = 188,
+	crudasm_intel_token_fxch = 189,
+	crudasm_intel_token_idiv = 190,
+	crudasm_intel_token_imul = 191,
+	crudasm_intel_token_in = 192,
+	crudasm_intel_token_ins = 193,
+	crudasm_intel_token_int1 = 194,
+	crudasm_intel_token_int3 = 195,
+	crudasm_intel_token_iret = 196,
+	crudasm_intel_token_jmp = 197,
+	crudasm_intel_token_lods = 198,
+	crudasm_intel_token_loop = 199,
+	crudasm_intel_token_loopnz = 200,
+	crudasm_intel_token_loopz = 201,
+	crudasm_intel_token_mov = 202,
+	crudasm_intel_token_movs = 203,
+	crudasm_intel_token_movsd = 204,
+	crudasm_intel_token_mul = 205,
+	crudasm_intel_token_nop = 206,
+	crudasm_intel_token_out = 207,
+	crudasm_intel_token_outs = 208,
+	crudasm_intel_token_pop = 209,
+	crudasm_intel_token_popa = 210,
+	crudasm_intel_token_popf = 211,
+	crudasm_intel_token_push = 212,
+	crudasm_intel_token_pusha = 213,
+	crudasm_intel_token_pushf = 214,
+	crudasm_intel_token_ret = 215,
+	crudasm_intel_token_retf = 216,
+	crudasm_intel_token_salc = 217,
+	crudasm_intel_token_scas = 218,
+	crudasm_intel_token_shl = 219,
+	crudasm_intel_token_stos = 220,
+	crudasm_intel_token_test = 221,
+	crudasm_intel_token_xchg = 222,
+	crudasm_intel_token_xlatb = 223,
+	crudasm_intel_token_cbw = 224,
+	crudasm_intel_token_cwd = 227,
+	crudasm_intel_token_jcxz = 230,
+	crudasm_intel_token_cmpxchg8b = 233,
+	crudasm_intel_token_fxrstor = 235,
+	crudasm_intel_token_fxsave = 237,
+	crudasm_intel_token__count = 239
+};
+
@@ -1,7 +1,7 @@
 // out_intel_encoding_table.h  (note: this file was automatically generated -- do not edit!)
 // Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.
 
-struct crudasm_intel_encoding_t crudasm_intel_encoding_table[] = {
+const struct crudasm_intel_encoding_t crudasm_intel_encoding_table[] = {
 	{crudasm_intel_insn_hlt, 0x0, 0xf4, 0x100, 0x7, 0xf, 0xf, 0x1, {0,0,0,0},{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},0},
 	{crudasm_intel_insn_aaa, 0x0, 0x37, 0x100, 0x7, 0xf, 0xf, 0x1, {0,0,0,0},{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},0|crudasm_intel_etag_no64},
 	{crudasm_intel_insn__aad, 0x0, 0xd5, 0x100, 0x7, 0xf, 0xf, 0x1, {crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argsize_B1,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},0|crudasm_intel_etag_no64},
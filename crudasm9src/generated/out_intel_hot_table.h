@@ -0,0 +1,590 @@
+// out_intel_hot_table.h  (note: this file was automatically generated -- do not edit!)
+// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.
+
+CRUDASM_TABLE_ALIGN const struct crudasm_intel_encoding_hot_t crudasm_intel_encoding_hot_table[] = {
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_hlt, 0x0, 0xf000, 0x1, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_aaa, 0x1, 0xf000, 0x0, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__aad, 0x1, 0xf001, 0x0, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__aam, 0x1, 0xf001, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_aas, 0x1, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_das, 0x1, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_daa, 0x1, 0xf000, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_adc, 0x0, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_adc, 0x2, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_adc, 0x4, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_adc, 0xc, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_adc, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_adc, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_adc, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_adc, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_adc, 0x0, 0xe002, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_adc, 0x4, 0xe003, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_add, 0x0, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_add, 0x2, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_add, 0x4, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_add, 0xc, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_add, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_add, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_add, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_add, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_add, 0x0, 0xe002, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_add, 0x4, 0xe003, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_or, 0x0, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_or, 0x2, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_or, 0x4, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_or, 0xc, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_or, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_or, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_or, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_or, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_or, 0x0, 0xe002, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_or, 0x4, 0xe003, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sbb, 0x0, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sbb, 0x2, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sbb, 0x4, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sbb, 0xc, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sbb, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sbb, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sbb, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sbb, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sbb, 0x0, 0xe002, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sbb, 0x4, 0xe003, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_and, 0x0, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_and, 0x2, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_and, 0x4, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_and, 0xc, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_and, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_and, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_and, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_and, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_and, 0x0, 0xe002, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_and, 0x4, 0xe003, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sub, 0x0, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sub, 0x2, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sub, 0x4, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sub, 0xc, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sub, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sub, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sub, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sub, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sub, 0x0, 0xe002, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sub, 0x4, 0xe003, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xor, 0x0, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xor, 0x2, 0xe002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xor, 0x4, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xor, 0xc, 0xe003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xor, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xor, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xor, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xor, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xor, 0x0, 0xe002, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xor, 0x4, 0xe003, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmp, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmp, 0x2, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmp, 0x4, 0xe003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmp, 0xc, 0xe003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmp, 0x0, 0xf002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmp, 0x0, 0xf002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmp, 0x0, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmp, 0x0, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmp, 0x0, 0xe002, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmp, 0x4, 0xe003, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rol, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rol, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rol, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rol, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rol, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rol, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ror, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ror, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ror, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ror, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ror, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ror, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcl, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcl, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcl, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcl, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcl, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcl, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcr, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcr, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcr, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcr, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcr, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rcr, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shl, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shl, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shl, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shl, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shl, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shl, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shr, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shr, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shr, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shr, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shr, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shr, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__sal, 0x2, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__sal, 0x2, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__sal, 0x2, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__sal, 0x2, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__sal, 0x2, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__sal, 0x2, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sar, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sar, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sar, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_implict,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sar, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sar, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sar, 0x0, 0xe004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_ea,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_invept, 0x0, 0xe005, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_ea,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_invvpid, 0x0, 0xe005, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_vmcall, 0x0, 0xf000, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_vmclear, 0x0, 0xf006, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_vmlaunch, 0x0, 0xf000, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_vmresume, 0x0, 0xf000, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_vmptrld, 0x0, 0xf006, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_vmptrst, 0x0, 0xf006, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_vmread, 0x0, 0xf007, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_vmwrite, 0x0, 0xf007, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_vmxoff, 0x0, 0xf000, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_vmxon, 0x0, 0xf006, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fxtract, 0x0, 0xf000, 0x0, 1},
+	{{crudasm_intel_argtype_reg_mmx,crudasm_intel_argtype_reg_mmx,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_phaddw, 0x0, 0xf008, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_phaddw, 0x0, 0xf009, 0x0, 1},
+	{{crudasm_intel_argtype_reg_mmx,crudasm_intel_argtype_reg_mmx,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_phaddd, 0x0, 0xf008, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_phaddd, 0x0, 0xf009, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_f2xm1, 0x0, 0xf000, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fcos, 0x0, 0xf000, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movaps, 0x0, 0xf009, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movaps, 0x0, 0xf009, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_stmxcsr, 0x0, 0xf00a, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ldmxcsr, 0x0, 0xf00a, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movdqu, 0x0, 0xf009, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movdqu, 0x0, 0xf009, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movsd2, 0x0, 0xf008, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movsd2, 0x0, 0xf008, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movss, 0x0, 0xf00b, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movss, 0x0, 0xf00b, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movdqa, 0x0, 0xf009, 0x0, 1},
+	{{crudasm_intel_argtype_reg_xmm,crudasm_intel_argtype_reg_xmm,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movdqa, 0x0, 0xf009, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_prefetch, 0x0, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_prefetchw, 0x0, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x0, 0xf002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x0, 0xf002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x0, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x0, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_fulldisp,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x10, 0xf002, 0x0, 0},
+	{{crudasm_intel_argtype_mem_fulldisp,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x10, 0xf002, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_fulldisp,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x10, 0xf003, 0x0, 0},
+	{{crudasm_intel_argtype_mem_fulldisp,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x10, 0xf003, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x20, 0xe002, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_both,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x30, 0xe003, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mov, 0x4, 0xe003, 0x0, 1},
+	{{crudasm_intel_argtype_mem_implict_std,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x2,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__ins, 0x40, 0xe00c, 0x4, 0},
+	{{crudasm_intel_argtype_mem_implict_std,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x2,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__ins, 0x40, 0xe00d, 0x4, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_implict_sts,0,0},{0x2,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__outs, 0x40, 0xd00e, 0x4, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_implict_sts,0,0},{0x2,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__outs, 0x40, 0xd00f, 0x4, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_ea_dbl,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_bound, 0x1, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_arpl, 0x80, 0xf010, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movsxd, 0x100, 0xe011, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rsm, 0x0, 0xf000, 0x1, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ud2, 0x0, 0xf000, 0x1, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sysenter, 0x0, 0xf000, 0x1, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sysexit, 0x0, 0xf000, 0x1, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_syscall, 0x0, 0xf000, 0x1, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sysret, 0x0, 0xf000, 0x1, 0},
+	{{crudasm_intel_argtype_mem_ea_lim,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sgdt, 0x0, 0xf012, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea_lim,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sidt, 0x0, 0xf012, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea_lim,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lgdt, 0x0, 0xf012, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea_lim,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lidt, 0x0, 0xf012, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sldt, 0x0, 0xe012, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sldt, 0x200, 0xe013, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lldt, 0x0, 0xf012, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_smsw, 0x0, 0xe012, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_smsw, 0x200, 0xe013, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lmsw, 0x0, 0xf012, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_str, 0x0, 0xe012, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_str, 0x200, 0xe013, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_verr, 0x0, 0xf012, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_verw, 0x0, 0xf012, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_wbinvd, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_wrmsr, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rdmsr, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rdpmc, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_rdtsc, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_clts, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cpuid, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_invd, 0x0, 0xf000, 0x0, 0},
+	{{crudasm_intel_argtype_mem_ea_eai,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_invlpg, 0x0, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lar, 0x0, 0xc014, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lar, 0x0, 0xc00d, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lsl, 0x0, 0xc014, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lsl, 0x0, 0xc00d, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ltr, 0x0, 0xf012, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_cr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movcr, 0x0, 0xf007, 0x0, 1},
+	{{crudasm_intel_argtype_reg_cr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movcr, 0x0, 0xf007, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_dr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movdr, 0x0, 0xf007, 0x0, 1},
+	{{crudasm_intel_argtype_reg_dr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movdr, 0x0, 0xf007, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_ea_seg,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_les, 0x1, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_ea_seg,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lds, 0x1, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_ea_seg,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lss, 0x40, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_ea_seg,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lfs, 0x40, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_ea_seg,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lgs, 0x40, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_bsf, 0x0, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_bsr, 0x0, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_imm_1st,crudasm_intel_argtype_imm_2nd,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_enter, 0x400, 0xf00e, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_leave, 0x0, 0xf000, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__bt_mem_reg, 0x0, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__bt_other, 0x0, 0xc003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__bt_other, 0x0, 0xc004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_bts, 0x0, 0xc003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_bts, 0x0, 0xc004, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_btr, 0x0, 0xc003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_btr, 0x0, 0xc004, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_btc, 0x0, 0xc003, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_btc, 0x0, 0xc004, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_bswap, 0x820, 0xe015, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmpxchg, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmpxchg, 0x0, 0xf003, 0x2, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__cmpxchgxb, 0x0, 0xe016, 0x2, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__cmpxchgxb, 0x2, 0xe016, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movzx, 0x800, 0xc004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movzx, 0x800, 0xc017, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movsx, 0x800, 0xc004, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_movsx, 0x800, 0xc017, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shld, 0x0, 0xf018, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,0x1,crudasm_intel_argvalue_default},crudasm_intel_insn_shld, 0x0, 0xf018, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_shrd, 0x0, 0xf018, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,0x1,crudasm_intel_argvalue_default},crudasm_intel_insn_shrd, 0x0, 0xf018, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xadd, 0x0, 0xf002, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_xadd, 0x0, 0xf003, 0x2, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cli, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sti, 0x0, 0xf000, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_in, 0x0, 0xc002, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_in, 0x0, 0xc019, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{0x0,0x2,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_in, 0x0, 0xc00c, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{0x0,0x2,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_in, 0x0, 0xc01a, 0x0, 0},
+	{{crudasm_intel_argtype_imm_1st,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_out, 0x0, 0xc002, 0x0, 0},
+	{{crudasm_intel_argtype_imm_1st,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_out, 0x0, 0xc01b, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{0x2,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_out, 0x0, 0xc00e, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{0x2,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_out, 0x0, 0xc01c, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovo, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovno, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovc, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovnc, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovz, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovnz, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovbe, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmova, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovs, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovns, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovp, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovnp, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovl, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovge, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovle, 0x1000, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmovg, 0x1000, 0xf003, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_emms, 0x0, 0xf000, 0x0, 0},
+	{{crudasm_intel_argtype_mem_ea_fxs,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__fxrstor, 0x0, 0xf01d, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea_fxs,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__fxsave, 0x0, 0xf01d, 0x0, 1},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__pushsr, 0x1, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__pushsr, 0x1, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x2,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__pushsr, 0x1, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x3,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__pushsr, 0x1, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x4,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__pushsr, 0x400, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x5,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__pushsr, 0x400, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__popsr, 0x1, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x2,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__popsr, 0x1, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x3,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__popsr, 0x1, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x4,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__popsr, 0x400, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_sr,0,0,0},{0x5,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__popsr, 0x400, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__push, 0x420, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__push, 0x404, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__push, 0x40c, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__push, 0x400, 0xe013, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__pop, 0x420, 0xe013, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__pop, 0x400, 0xe013, 0x0, 1},
+	{{crudasm_intel_argtype_reg_sr,crudasm_intel_argtype_reg_gr,0,0},{0x0,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movsrv, 0x0, 0xf010, 0x0, 1},
+	{{crudasm_intel_argtype_reg_sr,crudasm_intel_argtype_reg_gr,0,0},{0x2,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movsrv, 0x0, 0xf010, 0x0, 1},
+	{{crudasm_intel_argtype_reg_sr,crudasm_intel_argtype_reg_gr,0,0},{0x3,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movsrv, 0x0, 0xf010, 0x0, 1},
+	{{crudasm_intel_argtype_reg_sr,crudasm_intel_argtype_reg_gr,0,0},{0x4,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movsrv, 0x0, 0xf010, 0x0, 1},
+	{{crudasm_intel_argtype_reg_sr,crudasm_intel_argtype_reg_gr,0,0},{0x5,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movsrv, 0x0, 0xf010, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe00d, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe00d, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x2,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe00d, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x3,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe00d, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x4,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe00d, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x5,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe00d, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe01e, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe01e, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x2,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe01e, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x3,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe01e, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x4,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe01e, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_sr,0,0},{crudasm_intel_argvalue_reg_or_mem,0x5,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movvsr, 0x0, 0xe01e, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__pusha, 0x1, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__popa, 0x1, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__pushf, 0x400, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__popf, 0x400, 0xf000, 0x0, 0},
+	{{crudasm_intel_argtype_mem_implict_std,crudasm_intel_argtype_mem_implict_sts,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movs, 0x0, 0xf002, 0x4, 0},
+	{{crudasm_intel_argtype_mem_implict_std,crudasm_intel_argtype_mem_implict_sts,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__movs, 0x0, 0xf003, 0x4, 0},
+	{{crudasm_intel_argtype_mem_implict_sts,crudasm_intel_argtype_mem_implict_std,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__cmps, 0x0, 0xf002, 0x8, 0},
+	{{crudasm_intel_argtype_mem_implict_sts,crudasm_intel_argtype_mem_implict_std,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__cmps, 0x0, 0xf003, 0x8, 0},
+	{{crudasm_intel_argtype_mem_implict_std,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__stos, 0x0, 0xf002, 0x4, 0},
+	{{crudasm_intel_argtype_mem_implict_std,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__stos, 0x0, 0xf003, 0x4, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_implict_sts,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__lods, 0x0, 0xf002, 0x4, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_implict_sts,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__lods, 0x0, 0xf003, 0x4, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_implict_std,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__scas, 0x0, 0xf002, 0x4, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_implict_std,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__scas, 0x0, 0xf003, 0x4, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__test, 0x0, 0xf002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__test, 0x0, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__test, 0x0, 0xe002, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__test, 0x4, 0xe003, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__test, 0x0, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__test, 0x4, 0xe003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__test, 0x2, 0xe002, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__test, 0x6, 0xe003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__xchg, 0x0, 0xf002, 0x10, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__xchg, 0x0, 0xf003, 0x10, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__xchg, 0x20, 0xf003, 0x10, 0},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_not, 0x0, 0xe001, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_not, 0x0, 0xe013, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_neg, 0x0, 0xe001, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_neg, 0x0, 0xe013, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_inc, 0x21, 0xe013, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_inc, 0x0, 0xe001, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_inc, 0x0, 0xe013, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_dec, 0x21, 0xe013, 0x2, 0},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_dec, 0x0, 0xe001, 0x2, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_dec, 0x0, 0xe013, 0x2, 1},
+	{{crudasm_intel_argtype_mem_implict_xls,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__xlat, 0x0, 0xf001, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seto, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seto, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seto, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seto, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seto, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seto, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seto, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seto, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setno, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setno, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setno, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setno, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setno, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setno, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setno, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setno, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setc, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnc, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnc, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setz, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnz, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnz, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setbe, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setbe, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setbe, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setbe, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setbe, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setbe, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setbe, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setbe, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seta, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seta, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seta, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seta, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seta, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seta, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seta, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_seta, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sets, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sets, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sets, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sets, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sets, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sets, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sets, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sets, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setns, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setns, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setns, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setns, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setns, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setns, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setns, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setns, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setp, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnp, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setnp, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setl, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setl, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setl, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setl, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setl, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setl, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setl, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setl, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setge, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setge, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setge, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setge, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setge, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setge, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setge, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setge, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setle, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setle, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setle, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setle, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setle, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setle, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setle, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setle, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setg, 0x1000, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setg, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setg, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setg, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setg, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setg, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setg, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_setg, 0x1002, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__nopmb, 0x0, 0xe013, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__usalc, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__sxacc, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__sxdax, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_sahf, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lahf, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cmc, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_clc, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_stc, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_cld, 0x0, 0xf000, 0x0, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_std, 0x0, 0xf000, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_mem_ea_eal,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_lea, 0x0, 0xc01f, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_into, 0x1, 0xf000, 0x0, 0},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__cmul3, 0x4, 0xf020, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_imm_1st,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__cmul3, 0xc, 0xf020, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__cmul2, 0x0, 0xf003, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__imulb, 0x0, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_imul, 0x0, 0xe013, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__mulb, 0x0, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_mul, 0x0, 0xe013, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__divb, 0x0, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_div, 0x0, 0xe013, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__idivb, 0x0, 0xf001, 0x0, 1},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_idiv, 0x0, 0xe013, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__uint1, 0x0, 0xf000, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jo, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jo, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jno, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jno, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jc, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jc, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jnc, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jnc, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jz, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jz, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jnz, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jnz, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jbe, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jbe, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ja, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_ja, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_js, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_js, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jns, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jns, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jp, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jp, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jnp, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jnp, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jl, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jl, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jge, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jge, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jle, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jle, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jg, 0x300c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jg, 0x3004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_call, 0x2004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__calli, 0x0, 0xe021, 0x1, 1},
+	{{crudasm_intel_argtype_imm_1st,crudasm_intel_argtype_imm_2nd,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__callfd, 0x1, 0xe00d, 0x1, 0},
+	{{crudasm_intel_argtype_mem_ea_seg,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__callfi, 0x0, 0xe021, 0x1, 1},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jmp, 0x2004, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_jmp, 0x200c, 0xe021, 0x1, 0},
+	{{crudasm_intel_argtype_reg_gr,0,0,0},{crudasm_intel_argvalue_reg_or_mem,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__jmpi, 0x0, 0xe021, 0x1, 1},
+	{{crudasm_intel_argtype_imm_1st,crudasm_intel_argtype_imm_2nd,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__jmpfd, 0x1, 0xe00d, 0x1, 0},
+	{{crudasm_intel_argtype_mem_ea_seg,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__jmpfi, 0x0, 0xe021, 0x1, 1},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__retnum, 0x0, 0xf012, 0x1, 0},
+	{{crudasm_intel_argtype_imm_implict,0,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__ret, 0x0, 0xf012, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__retfnum, 0x0, 0xf012, 0x1, 0},
+	{{crudasm_intel_argtype_imm_implict,0,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__retf, 0x0, 0xf012, 0x1, 0},
+	{{crudasm_intel_argtype_imm_implict,0,0,0},{0x3,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__int3, 0x0, 0xf001, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_int, 0x0, 0xf001, 0x1, 0},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__iret, 0x0, 0xf000, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__loopnz, 0x200c, 0xc022, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__loopz, 0x200c, 0xc022, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__loop, 0x200c, 0xc022, 0x1, 0},
+	{{crudasm_intel_argtype_imm_1st,crudasm_intel_argtype_reg_gr,0,0},{crudasm_intel_argvalue_default,0x1,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__jrcxz, 0x200c, 0xc022, 0x1, 0},
+	{{crudasm_intel_argtype_reg_st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__fxch, 0x200, 0xf023, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fst, 0x0, 0xe00a, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fst, 0x0, 0xe006, 0x0, 1},
+	{{crudasm_intel_argtype_reg_st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fst, 0x200, 0xe023, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fstp, 0x0, 0xe00a, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fstp, 0x0, 0xe006, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fstp, 0x0, 0xe023, 0x0, 1},
+	{{crudasm_intel_argtype_reg_st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fstp, 0x200, 0xe023, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__fstcw, 0x0, 0xf012, 0x20, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fldcw, 0x0, 0xf012, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fld, 0x0, 0xe00a, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fld, 0x0, 0xe006, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fld, 0x0, 0xe023, 0x0, 1},
+	{{crudasm_intel_argtype_reg_st,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fld, 0x200, 0xe023, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__fmul1, 0x0, 0xe00a, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__fmul1, 0x0, 0xe006, 0x0, 1},
+	{{crudasm_intel_argtype_reg_st,crudasm_intel_argtype_reg_st,0,0},{0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__fmul2, 0x200, 0xf024, 0x0, 1},
+	{{crudasm_intel_argtype_reg_st,crudasm_intel_argtype_reg_st,0,0},{crudasm_intel_argvalue_default,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn__fmul2, 0x200, 0xf024, 0x0, 1},
+	{{crudasm_intel_argtype_reg_st,crudasm_intel_argtype_reg_st,0,0},{crudasm_intel_argvalue_default,0x0,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fmulp, 0x200, 0xf024, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fimul, 0x0, 0xe00a, 0x0, 1},
+	{{crudasm_intel_argtype_mem_ea,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_fimul, 0x0, 0xe012, 0x0, 1},
+	{{0,0,0,0},{crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default,crudasm_intel_argvalue_default},crudasm_intel_insn_wait, 0x0, 0xf000, 0x0, 0}
+};
+
@@ -1,7 +1,7 @@
 // out_intel_insn_table.h  (note: this file was automatically generated -- do not edit!)
 // Copyright (C) 2012 Willow Schlanger. All rights reserved.
 
-struct crudasm_intel_insn_t crudasm_intel_insns[] = {
+const struct crudasm_intel_insn_t crudasm_intel_insns[] = {
 	{"_aad", 0, 0, 0x2, 0x2, 1, {crudasm_intel_argsize_B1,0,0,0}},
 	{"_aam", 0, 0, 0x3, 0x3, 1, {crudasm_intel_argsize_B1,0,0,0}},
 	{"_bt_mem_reg", 0, 0, 0xea, 0xea, 2, {-1,-1,0,0}},
@@ -0,0 +1,146 @@
+// out_intel_length_table.h  (note: this file was automatically generated -- do not edit!)
+// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.
+
+CRUDASM_TABLE_ALIGN const U4 crudasm_intel_length_table[] = {
+	0x0,0x2000000,0x2111111,0x2111111,0x2000000,0x2000000,0x2000000,0x11111111,
+	0x11111111,0x11442442,0x11111111,0x11000000,0x1000000,0x11000000,0x1000000,0x111111,
+	0x442442,0x11111111,0x11111111,0x11442442,0x11111111,0x11000000,0x1000000,0x11000000,
+	0x1000000,0x111111,0x442442,0x11111111,0x11111111,0x11442442,0x11111111,0x11000000,
+	0x1000000,0x11000000,0x1000000,0x111111,0x442442,0x11111111,0x11111111,0x11442442,
+	0x11111111,0x11000000,0x1000000,0x11000000,0x1000000,0x111111,0x442442,0x11111111,
+	0x11111111,0x11442442,0x11111111,0x11000000,0x1000000,0x11000000,0x1000000,0x111111,
+	0x442442,0x11111111,0x11111111,0x11442442,0x11111111,0x11000000,0x1000000,0x11000000,
+	0x1000000,0x111111,0x442442,0x11111111,0x11111111,0x11442442,0x11111111,0x11000000,
+	0x1000000,0x11000000,0x1000000,0x111111,0x442442,0x1111111,0x1111111,0x1442442,
+	0x1111111,0x1000000,0x1000000,0x1000000,0x1000000,0x111111,0x442442,0x1111111,
+	0x1111111,0x1000000,0x1000000,0x1000000,0x1000000,0x1111111,0x1111111,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1111111,0x1111111,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1111111,0x1111111,0x1000000,0x1000000,0x1000000,0x1000000,0x1111111,
+	0x1111111,0x1000000,0x1000000,0x1000000,0x1000000,0x1111111,0x1111111,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1111111,0x1111111,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1111111,0x1111111,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x4000000,0x4000000,0x4000000,0x4000000,
+	0x111111,0x882442,0x1111111,0x1442442,0x0,0x0,0x0,0x0,
+	0x3000000,0x1000000,0x1000000,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x3000000,0x3000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x333333,0x0,0x1000000,0x1000000,0x1111111,0x11000000,0x11111111,0x11000000,
+	0x11111111,0x11000000,0x11111111,0x0,0x11000000,0x11000000,0x9000000,0x9000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1111111,0x1000000,0x1111111,0x1000000,
+	0x11000000,0x11000000,0x0,0x0,0x111111,0x111111,0x0,0x0,
+	0x111111,0x111111,0x0,0x0,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x0,0x1000000,0x1000000,0x2000000,
+	0x2000000,0x2000000,0x2000000,0x0,0x0,0x2000000,0x2000000,0x2000000,
+	0x0,0x0,0x0,0x442442,0x111111,0x1000000,0x0,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x2000000,0x2000000,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1000000,
+	0x1000000,0x111111,0x442442,0x1111111,0x1442442,0x1111111,0x1442442,0x11000000,
+	0x11000000,0x0,0x11000000,0x11000000,0x11000000,0x11000000,0x2000000,0x11000000,
+	0x11000000,0x2000000,0x11000000,0x11000000,0x0,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x1000000,0x2000000,0x1442442,0x1111111,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x0,0x111111,0x444442,
+	0x111111,0x444442,0x111111,0x444442,0x111111,0x444442,0x111111,0x444442,
+	0x111111,0x444442,0x111111,0x444442,0x111111,0x444442,0x111111,0x444442,
+	0x111111,0x444442,0x111111,0x444442,0x111111,0x444442,0x111111,0x444442,
+	0x111111,0x444442,0x111111,0x444442,0x111111,0x444442,0x444442,0x1000000,
+	0x2ff4664,0x1000000,0x444442,0x111111,0x1000000,0x2ff4664,0x1000000,0x222222,
+	0x0,0x222222,0x0,0x0,0x111111,0x0,0x111111,0x111111,
+	0x111111,0x111111,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x41000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x0
+};
+
+CRUDASM_TABLE_ALIGN const U4 crudasm_intel_length_opcode_table[] = {
+	0x11000000,0x11000000,0x1000000,0x1000000,0x111111,0x442442,0x2000000,0x2000000,
+	0x11000000,0x11000000,0x1000000,0x1000000,0x111111,0x442442,0x2000000,0x80000000,
+	0x11000000,0x11000000,0x1000000,0x1000000,0x111111,0x442442,0x2000000,0x2000000,
+	0x11000000,0x11000000,0x1000000,0x1000000,0x111111,0x442442,0x2000000,0x2000000,
+	0x11000000,0x11000000,0x1000000,0x1000000,0x111111,0x442442,0x80000000,0x2000000,
+	0x11000000,0x11000000,0x1000000,0x1000000,0x111111,0x442442,0x80000000,0x2000000,
+	0x11000000,0x11000000,0x1000000,0x1000000,0x111111,0x442442,0x80000000,0x2000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x111111,0x442442,0x80000000,0x2000000,
+	0x2000000,0x2000000,0x2000000,0x2000000,0x2000000,0x2000000,0x2000000,0x2000000,
+	0x2000000,0x2000000,0x2000000,0x2000000,0x2000000,0x2000000,0x2000000,0x2000000,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x2000000,0x2000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x442442,0x1442442,0x111111,0x1111111,0x0,0x0,0x0,0x0,
+	0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,
+	0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x1000000,0x1000000,0x11000000,0x11000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x2ff4664,0x0,0x0,0x0,0x0,0x0,
+	0x4000000,0x4000000,0x4000000,0x4000000,0x0,0x0,0x0,0x0,
+	0x111111,0x442442,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,
+	0x882442,0x882442,0x882442,0x882442,0x882442,0x882442,0x882442,0x882442,
+	0x1111111,0x1111111,0x222222,0x0,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x333333,0x0,0x222222,0x0,0x0,0x111111,0x2000000,0x0,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x2111111,0x2111111,0x0,0x0,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,0x111111,
+	0x444442,0x444442,0x2ff4664,0x111111,0x0,0x0,0x0,0x0,
+	0x80000000,0x0,0x80000000,0x80000000,0x0,0x0,0x80000000,0x80000000,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x1000000,0x1000000,0x80000000,0x0,0x0,0x0,
+	0x0,0x0,0x80000000,0x0,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x1000000,0x1000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x0,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x444442,0x444442,0x444442,0x444442,0x444442,0x444442,0x444442,0x444442,
+	0x444442,0x444442,0x444442,0x444442,0x444442,0x444442,0x444442,0x444442,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x0,0x0,0x0,0x1000000,0x1111111,0x1000000,0x80000000,0x80000000,
+	0x0,0x0,0x0,0x11000000,0x1111111,0x1000000,0x80000000,0x1000000,
+	0x11000000,0x11000000,0x80000000,0x11000000,0x80000000,0x80000000,0x1000000,0x1000000,
+	0x80000000,0x80000000,0x80000000,0x11000000,0x1000000,0x1000000,0x1000000,0x1000000,
+	0x11000000,0x11000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,
+	0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000,0x80000000
+};
+
@@ -0,0 +1,279 @@
+// out_intel_token_table.h  (note: this file was automatically generated -- do not edit!)
+// Copyright (C) 2012 Willow Schlanger. All rights reserved.
+
+CRUDASM_TABLE_ALIGN const struct crudasm_intel_token_t crudasm_intel_insn_tokens[] = {
+	{4, "_aad"},
+	{4, "_aam"},
+	{11, "_bt_mem_reg"},
+	{9, "_bt_other"},
+	{7, "_callfd"},
+	{7, "_callfi"},
+	{6, "_calli"},
+	{5, "_cmps"},
+	{10, "_cmpxchgxb"},
+	{6, "_cmul2"},
+	{6, "_cmul3"},
+	{5, "_divb"},
+	{6, "_fmul1"},
+	{6, "_fmul2"},
+	{6, "_fstcw"},
+	{5, "_fxch"},
+	{8, "_fxrstor"},
+	{7, "_fxsave"},
+	{6, "_idivb"},
+	{6, "_imulb"},
+	{4, "_ins"},
+	{5, "_int3"},
+	{5, "_iret"},
+	{6, "_jmpfd"},
+	{6, "_jmpfi"},
+	{5, "_jmpi"},
+	{6, "_jrcxz"},
+	{5, "_lods"},
+	{5, "_loop"},
+	{7, "_loopnz"},
+	{6, "_loopz"},
+	{6, "_movcr"},
+	{6, "_movdr"},
+	{5, "_movs"},
+	{7, "_movsd2"},
+	{7, "_movsrv"},
+	{7, "_movvsr"},
+	{5, "_mulb"},
+	{6, "_nopmb"},
+	{5, "_outs"},
+	{4, "_pop"},
+	{5, "_popa"},
+	{5, "_popf"},
+	{6, "_popsr"},
+	{5, "_push"},
+	{6, "_pusha"},
+	{6, "_pushf"},
+	{7, "_pushsr"},
+	{4, "_ret"},
+	{5, "_retf"},
+	{8, "_retfnum"},
+	{7, "_retnum"},
+	{4, "_sal"},
+	{5, "_scas"},
+	{5, "_stos"},
+	{6, "_sxacc"},
+	{6, "_sxdax"},
+	{5, "_test"},
+	{6, "_uint1"},
+	{6, "_usalc"},
+	{5, "_xchg"},
+	{5, "_xlat"},
+	{3, "aaa"},
+	{3, "aas"},
+	{3, "adc"},
+	{3, "add"},
+	{3, "and"},
+	{4, "arpl"},
+	{5, "bound"},
+	{3, "bsf"},
+	{3, "bsr"},
+	{5, "bswap"},
+	{3, "btc"},
+	{3, "btr"},
+	{3, "bts"},
+	{4, "call"},
+	{3, "clc"},
+	{3, "cld"},
+	{3, "cli"},
+	{4, "clts"},
+	{3, "cmc"},
+	{5, "cmova"},
+	{6, "cmovbe"},
+	{5, "cmovc"},
+	{5, "cmovg"},
+	{6, "cmovge"},
+	{5, "cmovl"},
+	{6, "cmovle"},
+	{6, "cmovnc"},
+	{6, "cmovno"},
+	{6, "cmovnp"},
+	{6, "cmovns"},
+	{6, "cmovnz"},
+	{5, "cmovo"},
+	{5, "cmovp"},
+	{5, "cmovs"},
+	{5, "cmovz"},
+	{3, "cmp"},
+	{7, "cmpxchg"},
+	{5, "cpuid"},
+	{3, "daa"},
+	{3, "das"},
+	{3, "dec"},
+	{3, "div"},
+	{4, "emms"},
+	{5, "enter"},
+	{5, "f2xm1"},
+	{4, "fcos"},
+	{5, "fimul"},
+	{3, "fld"},
+	{5, "fldcw"},
+	{5, "fmulp"},
+	{3, "fst"},
+	{4, "fstp"},
+	{7, "fxtract"},
+	{3, "hlt"},
+	{4, "idiv"},
+	{4, "imul"},
+	{2, "in"},
+	{3, "inc"},
+	{3, "int"},
+	{4, "into"},
+	{4, "invd"},
+	{6, "invept"},
+	{6, "invlpg"},
+	{7, "invvpid"},
+	{2, "ja"},
+	{3, "jbe"},
+	{2, "jc"},
+	{2, "jg"},
+	{3, "jge"},
+	{2, "jl"},
+	{3, "jle"},
+	{3, "jmp"},
+	{3, "jnc"},
+	{3, "jno"},
+	{3, "jnp"},
+	{3, "jns"},
+	{3, "jnz"},
+	{2, "jo"},
+	{2, "jp"},
+	{2, "js"},
+	{2, "jz"},
+	{4, "lahf"},
+	{3, "lar"},
+	{7, "ldmxcsr"},
+	{3, "lds"},
+	{3, "lea"},
+	{5, "leave"},
+	{3, "les"},
+	{3, "lfs"},
+	{4, "lgdt"},
+	{3, "lgs"},
+	{4, "lidt"},
+	{4, "lldt"},
+	{4, "lmsw"},
+	{3, "lsl"},
+	{3, "lss"},
+	{3, "ltr"},
+	{3, "mov"},
+	{6, "movaps"},
+	{6, "movdqa"},
+	{6, "movdqu"},
+	{5, "movss"},
+	{5, "movsx"},
+	{6, "movsxd"},
+	{5, "movzx"},
+	{3, "mul"},
+	{3, "neg"},
+	{3, "not"},
+	{2, "or"},
+	{3, "out"},
+	{6, "phaddd"},
+	{6, "phaddw"},
+	{8, "prefetch"},
+	{9, "prefetchw"},
+	{3, "rcl"},
+	{3, "rcr"},
+	{5, "rdmsr"},
+	{5, "rdpmc"},
+	{5, "rdtsc"},
+	{3, "rol"},
+	{3, "ror"},
+	{3, "rsm"},
+	{4, "sahf"},
+	{3, "sar"},
+	{3, "sbb"},
+	{4, "seta"},
+	{5, "setbe"},
+	{4, "setc"},
+	{4, "setg"},
+	{5, "setge"},
+	{4, "setl"},
+	{5, "setle"},
+	{5, "setnc"},
+	{5, "setno"},
+	{5, "setnp"},
+	{5, "setns"},
+	{5, "setnz"},
+	{4, "seto"},
+	{4, "setp"},
+	{4, "sets"},
+	{4, "setz"},
+	{4, "sgdt"},
+	{3, "shl"},
+	{4, "shld"},
+	{3, "shr"},
+	{4, "shrd"},
+	{4, "sidt"},
+	{4, "sldt"},
+	{4, "smsw"},
+	{3, "stc"},
+	{3, "std"},
+	{3, "sti"},
+	{7, "stmxcsr"},
+	{3, "str"},
+	{3, "sub"},
+	{7, "syscall"},
+	{8, "sysenter"},
+	{7, "sysexit"},
+	{6, "sysret"},
+	{3, "ud2"},
+	{4, "verr"},
+	{4, "verw"},
+	{6, "vmcall"},
+	{7, "vmclear"},
+	{8, "vmlaunch"},
+	{7, "vmptrld"},
+	{7, "vmptrst"},
+	{6, "vmread"},
+	{8, "vmresume"},
+	{7, "vmwrite"},
+	{6, "vmxoff"},
+	{5, "vmxon"},
+	{4, "wait"},
+	{6, "wbinvd"},
+	{5, "wrmsr"},
+	{4, "xadd"},
+	{3, "xor"},
+	{0}
+};
+
+CRUDASM_TABLE_ALIGN const struct crudasm_intel_token_t crudasm_intel_tokens[] = {
+	{2, "al"}, {2, "cl"}, {2, "dl"}, {2, "bl"}, {3, "spl"}, {3, "bpl"}, {3, "sil"}, {3, "dil"},
+	{3, "r8b"}, {3, "r9b"}, {4, "r10b"}, {4, "r11b"}, {4, "r12b"}, {4, "r13b"}, {4, "r14b"}, {4, "r15b"},
+	{2, "ah"}, {2, "ch"}, {2, "dh"}, {2, "bh"}, {2, "al"}, {2, "cl"}, {2, "dl"}, {2, "bl"},
+	{2, "ah"}, {2, "ch"}, {2, "dh"}, {2, "bh"}, {2, "ax"}, {2, "cx"}, {2, "dx"}, {2, "bx"},
+	{2, "sp"}, {2, "bp"}, {2, "si"}, {2, "di"}, {3, "r8w"}, {3, "r9w"}, {4, "r10w"}, {4, "r11w"},
+	{4, "r12w"}, {4, "r13w"}, {4, "r14w"}, {4, "r15w"}, {3, "eax"}, {3, "ecx"}, {3, "edx"}, {3, "ebx"},
+	{3, "esp"}, {3, "ebp"}, {3, "esi"}, {3, "edi"}, {3, "r8d"}, {3, "r9d"}, {4, "r10d"}, {4, "r11d"},
+	{4, "r12d"}, {4, "r13d"}, {4, "r14d"}, {4, "r15d"}, {3, "rax"}, {3, "rcx"}, {3, "rdx"}, {3, "rbx"},
+	{3, "rsp"}, {3, "rbp"}, {3, "rsi"}, {3, "rdi"}, {2, "r8"}, {2, "r9"}, {3, "r10"}, {3, "r11"},
+	{3, "r12"}, {3, "r13"}, {3, "r14"}, {3, "r15"}, {2, "es"}, {2, "cs"}, {2, "ss"}, {2, "ds"},
+	{2, "fs"}, {2, "gs"}, {2, "ss"}, {2, "ds"}, {4, "byte"}, {4, "word"}, {5, "dword"}, {5, "qword"},
+	{5, "xword"}, {5, "tword"}, {5, "lock "}, {4, "rep "}, {6, "repnz "}, {5, "repz "}, {4, "o16 "}, {4, "o32 "},
+	{4, "o64 "}, {4, "xmm0"}, {4, "xmm1"}, {4, "xmm2"}, {4, "xmm3"}, {4, "xmm4"}, {4, "xmm5"}, {4, "xmm6"},
+	{4, "xmm7"}, {4, "xmm8"}, {4, "xmm9"}, {5, "xmm10"}, {5, "xmm11"}, {5, "xmm12"}, {5, "xmm13"}, {5, "xmm14"},
+	{5, "xmm15"}, {3, "mm0"}, {3, "mm1"}, {3, "mm2"}, {3, "mm3"}, {3, "mm4"}, {3, "mm5"}, {3, "mm6"},
+	{3, "mm7"}, {3, "mm8"}, {3, "mm9"}, {4, "mm10"}, {4, "mm11"}, {4, "mm12"}, {4, "mm13"}, {4, "mm14"},
+	{4, "mm15"}, {3, "cr0"}, {3, "cr1"}, {3, "cr2"}, {3, "cr3"}, {3, "cr4"}, {3, "cr5"}, {3, "cr6"},
+	{3, "cr7"}, {3, "cr8"}, {3, "cr9"}, {4, "cr10"}, {4, "cr11"}, {4, "cr12"}, {4, "cr13"}, {4, "cr14"},
+	{4, "cr15"}, {3, "dr0"}, {3, "dr1"}, {3, "dr2"}, {3, "dr3"}, {3, "dr4"}, {3, "dr5"}, {3, "dr6"},
+	{3, "dr7"}, {3, "dr8"}, {3, "dr9"}, {4, "dr10"}, {4, "dr11"}, {4, "dr12"}, {4, "dr13"}, {4, "dr14"},
+	{4, "dr15"}, {3, "st0"}, {3, "st1"}, {3, "st2"}, {3, "st3"}, {3, "st4"}, {3, "st5"}, {3, "st6"},
+	{3, "st7"}, {3, "st8"}, {3, "st9"}, {4, "st10"}, {4, "st11"}, {4, "st12"}, {4, "st13"}, {4, "st14"},
+	{4, "st15"}, {6, "short "}, {5, "near "}, {4, "far "}, {4, "rel "}, {3, "$$+"}, {3, "aad"}, {3, "aam"},
+	{4, "call"}, {4, "cmps"}, {7, "cmpxchg"}, {3, "div"}, {4, "fmul"}, {4, "fxch"}, {4, "idiv"}, {4, "imul"},
+	{2, "in"}, {3, "ins"}, {4, "int1"}, {4, "int3"}, {4, "iret"}, {3, "jmp"}, {4, "lods"}, {4, "loop"},
+	{6, "loopnz"}, {5, "loopz"}, {3, "mov"}, {4, "movs"}, {5, "movsd"}, {3, "mul"}, {3, "nop"}, {3, "out"},
+	{4, "outs"}, {3, "pop"}, {4, "popa"}, {4, "popf"}, {4, "push"}, {5, "pusha"}, {5, "pushf"}, {3, "ret"},
+	{4, "retf"}, {4, "salc"}, {4, "scas"}, {3, "shl"}, {4, "stos"}, {4, "test"}, {4, "xchg"}, {5, "xlatb"},
+	{3, "cbw"}, {4, "cwde"}, {4, "cdqe"}, {3, "cwd"}, {3, "cdq"}, {3, "cqo"}, {4, "jcxz"}, {5, "jecxz"},
+	{5, "jrcxz"}, {9, "cmpxchg8b"}, {10, "cmpxchg16b"}, {7, "fxrstor"}, {9, "fxrstor64"}, {6, "fxsave"}, {8, "fxsave64"}
+};
+
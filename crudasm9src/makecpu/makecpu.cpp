@@ -57,6 +57,16 @@ struct InsnInfoT
 	U4 last_encoding;
 };
 
+// What the decoder needs from an encoding, besides the argument types and values
+// (see crudasm_intel_encoding_hot_t).
+struct HotEncodingT
+{
+	U2 etags;
+	U2 argsize_index;
+	U1 itags;
+	U1 has_modrm;
+};
+
 class IntelDecoderTableBuilder
 {
 	AxiomItemCpuArch *x86;
@@ -87,6 +97,15 @@ public:
 	}
 
 	std::string buildTable(std::vector<U4> &table);
+	std::string buildFlatTable(std::vector<U4> &flat, std::vector<U4> &table);
+	std::string buildCompactTable(std::vector<U2> &compact, std::vector<U2> &compact_flat, std::vector<U4> &table, std::vector<U4> &flat);
+	std::string compact_entry(U2 &out, U4 entry, std::vector<U4> &table, std::vector<U2> &compact, std::map<U4, U2> &done, std::map<std::vector<U2>, U2> &nodes);
+	std::string compact_node(U2 &offset, std::vector<U2> &node, std::vector<U2> &compact, std::map<std::vector<U2>, U2> &nodes);
+	std::string buildLengthTable(std::vector<U4> &table, std::vector<U4> &opcode_table, std::vector<U4> &decoder_table);
+	std::string buildControlTable(std::vector<U2> &table);
+	std::string buildArgSizeTable(std::vector<std::vector<signed char> > &rows, std::vector<U2> &index);
+	std::string buildHotTable(std::vector<HotEncodingT> &table, const std::vector<U2> &argsize_index);
+	std::string buildDecodeFuncs(std::vector<std::string> &funcs, std::vector<size_t> &func_index);
 	std::string process_decoder_encoding(AxiomCpuEncoding &enc, class OpcodeTableContainer *opcon, std::string insn_name);
 	std::string process_decoder_modrm(class OpcodeTable *table, size_t offset, AxiomCpuEncoding &enc, class OpcodeTableContainer *opcon, std::string insn_name, U4 enc_regop, U4 enc_mod, U4 enc_rm, U4 opcode1, U4 opcode2);
 	std::string process_decoder_entry(U4 enc_regop, U4 enc_mod, U4 enc_rm, U4 opcode1, U4 opcode2, class OpcodeTable *table, size_t offset, AxiomCpuEncoding &enc, class OpcodeTableContainer *opcon, std::string insn_name, int ext_index, int md_index, int size_override = -1);
@@ -113,6 +132,8 @@ Table codes:
        not compatible with (g); must be at end if used
 7 - g. 256 entry decoder, imm8 after modr/m (3DNow!)
        not compatible with (f); must be at end if used
+8 - h. low nibble of a type 1 byte (generated tables only; there
+       type 1 nodes have 16 entries, one per high nibble)
 */
 
 class OpcodeTable
@@ -799,6 +820,687 @@ std::string IntelDecoderTableBuilder::process_decoder_encoding(AxiomCpuEncoding
 	return "";	// success
 }
 
+//===============================================================================================//
+
+// Flags for crudasm_intel_length_table[] entries. The low 24 bits of an entry
+// hold 6 nibbles, each giving the number of immediate bytes that follow the
+// modr/m, sib and displacement bytes (0xf if the encoding can't be decoded):
+//    nibbles 0..1 : 16/32 bit mode, o16 and o32
+//    nibbles 2..5 : 64 bit mode, indexed by (66 prefix) + 2 * (rex.w)
+enum
+{
+	LENGTH_MODRM = 0x01000000,		// encoding has a modr/m byte
+	LENGTH_NO64 = 0x02000000,		// encoding is invalid in 64 bit mode
+	LENGTH_FULLDISP = 0x04000000,	// add an address-sized displacement
+	LENGTH_LOCK_MEM = 0x08000000,	// lock prefix is allowed
+	LENGTH_LOCK_RM = 0x10000000,	// lock prefix is allowed if modr/m selects memory
+	LENGTH_SREG = 0x20000000,		// modr/m reg field selects a segment register (must be 0..5)
+	LENGTH_FWAITABLE = 0x40000000,	// encoding may follow fwait
+	LENGTH_TREE = 0x80000000		// (opcode table only) walk the decoder table to find the encoding
+};
+
+size_t find_tag(std::map<AxiomItem, size_t> &tags, std::string name)
+{
+	for(std::map<AxiomItem, size_t>::iterator i = tags.begin(); i != tags.end(); ++i)
+	{
+		AxiomItem item = i->first;
+		if(item->getIdentifier()->getName() == name)
+			return i->second;
+	}
+	return 0;
+}
+
+// Resolves an argument size, by argsize name, for crudasm_intel_argsize_rows[].
+// Returns 0 for an unsupported size.
+int intel_arg_size_bytes(std::string size, int dsz, int osz, int asz)
+{
+	if(size == "B1")
+		return 1;
+	if(size == "B2")
+		return 2;
+	if(size == "B4")
+		return 4;
+	if(size == "B8")
+		return 8;
+	if(size == "B10")
+		return 10;
+	if(size == "B16")
+		return 16;
+	if(size == "B32")
+		return 32;
+	if(size == "size_osz")
+		return 2 << osz;
+	if(size == "size_asz")
+		return 2 << asz;
+	if(size == "size_osz_ptr")
+		return (dsz == 2) ? 8 : 4;
+	if(size == "size_osz_max32")
+		return (osz == 2) ? 4 : (2 << osz);
+	if(size == "size_osz_min32")
+		return (osz == 0) ? 4 : (2 << osz);
+	if(size == "size_osz_min64")
+		return (osz == 2) ? 16 : 8;
+	if(size == "size_osz_seg")
+		return (osz == 2) ? 8 : 2;
+	if(size == "size_osz_64in64")
+		return (dsz == 2) ? 8 : (2 << osz);
+	return 0;
+}
+
+// Collects the length table entries of all encodings reachable from a decoder
+// table node, without consuming any more opcode bytes. Returns false if that
+// can't be done, or if any path leads to an invalid opcode.
+static bool collect_length_entries(std::vector<U4> &decoder_table, std::vector<U4> &table, U4 node, std::set<U4> &entries)
+{
+	U4 type = node >> 24;
+	U4 offset = node & 0xffffff;
+	size_t size;
+	switch(type)
+	{
+	case 0:
+		if(offset == 0xffffff)
+			return false;
+		entries.insert(table[offset]);
+		return true;
+	case 2:
+		size = 6;
+		break;
+	case 3:
+		size = 32;
+		break;
+	case 4:
+	case 5:
+		size = 8;
+		break;
+	default:
+		return false;	// 1, 6, 7: leave these to the decoder table
+	}
+	for(size_t i = 0; i < size; ++i)
+	{
+		if(!collect_length_entries(decoder_table, table, decoder_table[offset + i], entries))
+			return false;
+	}
+	return true;
+}
+
+// Builds one entry per encoding for crudasm_intel_insn_length(). This has to
+// agree with get_arguments() and try_decode() in ../x86core/ixdecoder.c.
+//
+// opcode_table gets 512 entries, for 00..ff and 0f 00..0f ff. Where all the
+// encodings that an opcode leads to have the same length table entry, that
+// entry is used, and we don't need to walk the decoder table at all.
+std::string IntelDecoderTableBuilder::buildLengthTable(std::vector<U4> &table, std::vector<U4> &opcode_table, std::vector<U4> &decoder_table)
+{
+	size_t etag_no64 = find_tag(x86->etags, "etag_no64");
+	size_t etag_sx_byte = find_tag(x86->etags, "etag_sx_byte");
+	size_t etag_imm64_disp = find_tag(x86->etags, "etag_imm64_disp");
+	size_t etag_imm64_sx32 = find_tag(x86->etags, "etag_imm64_sx32");
+	size_t etag_no_rex_w = find_tag(x86->etags, "etag_no_rex_w");
+	size_t etag_is64 = find_tag(x86->etags, "etag_is64");
+	size_t itag_lockable = find_tag(x86->itags, "itag_lockable");
+	size_t itag_lock_always = find_tag(x86->itags, "itag_lock_always");
+	size_t itag_fwaitable = find_tag(x86->itags, "itag_fwaitable");
+
+	table.clear();
+	size_t numEncodings = x86->getNumEncodings();
+	for(size_t e = 0; e < numEncodings; ++e)
+	{
+		AxiomCpuEncoding *encoding = x86->getEncoding(e);
+		std::string insn_name = *encoding->insn->alias;
+		U4 entry = 0;
+
+		if(info[encoding].regop != 0xf)
+			entry |= LENGTH_MODRM;
+		if((encoding->etags & etag_no64) != 0)
+			entry |= LENGTH_NO64;
+		if((encoding->insn->insn_flags & itag_fwaitable) != 0)
+			entry |= LENGTH_FWAITABLE;
+
+		for(int i = 0; i < AXIOM_MAX_ASM_ARGS; ++i)
+		{
+			if(encoding->arg_types[i].isNull())
+				break;
+			std::string type = encoding->arg_types[i]->getIdentifier()->getName();
+			bool by_default = encoding->arg_values[i].isNull() || (encoding->arg_values[i]->getInteger() == NULL && encoding->arg_values[i]->getIdentifier()->getName() == "default");
+			bool reg_or_mem = !encoding->arg_values[i].isNull() && encoding->arg_values[i]->getInteger() == NULL && encoding->arg_values[i]->getIdentifier()->getName() == "reg_or_mem";
+			if(type == "mem_fulldisp")
+				entry |= LENGTH_FULLDISP;
+			if(type == "reg_sr" && (by_default || reg_or_mem))
+			{
+				if(reg_or_mem)
+					return std::string("length table: reg_or_mem segment register not supported, instruction: ") + insn_name;
+				entry |= LENGTH_SREG;
+			}
+			if(i == 0 && (encoding->insn->insn_flags & (itag_lockable | itag_lock_always)) != 0)
+			{
+				if(type.compare(0, 4, "mem_") == 0)
+					entry |= LENGTH_LOCK_MEM;
+				else
+				if(reg_or_mem)
+					entry |= LENGTH_LOCK_RM;
+			}
+		}
+
+		for(int n = 0; n < 6; ++n)
+		{
+			int dsz, osz;
+			if(n < 2)
+			{
+				dsz = 1;
+				osz = n;
+			}
+			else
+			{
+				// Same as try_decode().
+				int op66 = (n - 2) & 1;
+				int rex_w = (n - 2) >> 1;
+				bool is64 = (encoding->etags & etag_is64) != 0;
+				dsz = 2;
+				osz = (op66) ? 0 : 1;
+				if((encoding->etags & etag_no_rex_w) == 0 && (rex_w != 0 || is64))
+				{
+					osz = 2;
+					if(op66 && is64 && rex_w == 0)
+						osz = 0;
+				}
+			}
+
+			int imm = 0;
+			bool bad = false;
+			for(int i = 0; i < AXIOM_MAX_ASM_ARGS; ++i)
+			{
+				if(encoding->arg_types[i].isNull())
+					break;
+				std::string type = encoding->arg_types[i]->getIdentifier()->getName();
+				std::string size;
+				if(!encoding->arg_sizes[i].isNull())
+					size = encoding->arg_sizes[i]->getIdentifier()->getName();
+				if(size == "size_asz" && type.compare(0, 4, "imm_") == 0)
+					return std::string("length table: address-sized immediate not supported, instruction: ") + insn_name;
+				int bytes = intel_arg_size_bytes(size, dsz, osz, 1);
+				if(bytes <= 0)
+				{
+					bad = true;		// "Unsupported argument encountered"
+					break;
+				}
+				if(type.compare(0, 4, "imm_") != 0 || type == "imm_implict")
+					continue;
+				if((encoding->etags & etag_sx_byte) != 0)
+				{
+					if(bytes == 1)
+					{
+						bad = true;	// "internal error"
+						break;
+					}
+					imm += 1;
+				}
+				else
+				if(bytes == 8 && (encoding->etags & etag_imm64_disp) != 0)
+					imm += 8;
+				else
+				if(bytes == 8)
+				{
+					if((encoding->etags & etag_imm64_sx32) == 0)
+					{
+						bad = true;	// "imm64_sx32 missing from script file"
+						break;
+					}
+					imm += 4;
+				}
+				else
+					imm += bytes;
+			}
+			if(bad)
+				imm = 0xf;
+			else
+			if(imm >= 0xf)
+				return std::string("length table: immediates too large, instruction: ") + insn_name;
+			entry |= static_cast<U4>(imm) << (4 * n);
+		}
+
+		table.push_back(entry);
+	}
+
+	opcode_table.clear();
+	U4 root = decoder_table.back();
+	for(U4 opcode = 0; opcode < 0x200; ++opcode)
+	{
+		U4 node = decoder_table[(root & 0xffffff) + (opcode & 0xff)];
+		if(opcode >= 0x100)
+		{
+			node = decoder_table[(root & 0xffffff) + 0x0f];
+			if((node >> 24) != 1)
+				return "length table: unexpected decoder table layout for 0f";
+			node = decoder_table[(node & 0xffffff) + (opcode & 0xff)];
+		}
+		std::set<U4> entries;
+		if(opcode == 0x0f || !collect_length_entries(decoder_table, table, node, entries) || entries.size() != 1)
+			opcode_table.push_back(LENGTH_TREE);
+		else
+			opcode_table.push_back(*entries.begin());
+	}
+
+	return "";	// success
+}
+
+// crudasm_intel_control_table[] entries. The low 4 bits give the kind of
+// control transfer, the rest are flags.
+enum
+{
+	CONTROL_NONE = 0,		// falls through to the next instruction
+	CONTROL_JCC = 1,
+	CONTROL_JMP = 2,
+	CONTROL_CALL = 3,
+	CONTROL_RET = 4,
+	CONTROL_LOOP = 5,		// loop, loopz, loopnz, jcxz
+	CONTROL_INT = 6,		// software interrupts and system calls
+	CONTROL_HALT = 7,		// hlt, ud2
+	CONTROL_KIND = 0x000f,
+	CONTROL_RELATIVE = 0x0010,	// target is relative to the next instruction
+	CONTROL_FAR = 0x0020,		// changes cs
+	CONTROL_INDIRECT = 0x0040,	// target comes from a register or memory
+	CONTROL_TERMINAL = 0x0080,	// never goes on to the next instruction
+	CONTROL_REL8 = 0x0100,		// relative target is a sign-extended byte
+	CONTROL_REL_OSZ = 0x0200	// relative target is operand-sized (32 bits in 64 bit mode)
+};
+
+// Kinds of control transfer, by instruction name.
+static const struct
+{
+	const char *name;
+	U2 entry;
+} control_insns[] =
+{
+	{"jo", CONTROL_JCC}, {"jno", CONTROL_JCC}, {"jc", CONTROL_JCC}, {"jnc", CONTROL_JCC},
+	{"jz", CONTROL_JCC}, {"jnz", CONTROL_JCC}, {"jbe", CONTROL_JCC}, {"ja", CONTROL_JCC},
+	{"js", CONTROL_JCC}, {"jns", CONTROL_JCC}, {"jp", CONTROL_JCC}, {"jnp", CONTROL_JCC},
+	{"jl", CONTROL_JCC}, {"jge", CONTROL_JCC}, {"jle", CONTROL_JCC}, {"jg", CONTROL_JCC},
+	{"jmp", CONTROL_JMP | CONTROL_TERMINAL},
+	{"_jmpi", CONTROL_JMP | CONTROL_INDIRECT | CONTROL_TERMINAL},
+	{"_jmpfd", CONTROL_JMP | CONTROL_FAR | CONTROL_TERMINAL},
+	{"_jmpfi", CONTROL_JMP | CONTROL_FAR | CONTROL_INDIRECT | CONTROL_TERMINAL},
+	{"call", CONTROL_CALL},
+	{"_calli", CONTROL_CALL | CONTROL_INDIRECT},
+	{"_callfd", CONTROL_CALL | CONTROL_FAR},
+	{"_callfi", CONTROL_CALL | CONTROL_FAR | CONTROL_INDIRECT},
+	{"_ret", CONTROL_RET | CONTROL_TERMINAL},
+	{"_retnum", CONTROL_RET | CONTROL_TERMINAL},
+	{"_retf", CONTROL_RET | CONTROL_FAR | CONTROL_TERMINAL},
+	{"_retfnum", CONTROL_RET | CONTROL_FAR | CONTROL_TERMINAL},
+	{"_iret", CONTROL_RET | CONTROL_FAR | CONTROL_TERMINAL},
+	{"sysexit", CONTROL_RET | CONTROL_FAR | CONTROL_TERMINAL},
+	{"sysret", CONTROL_RET | CONTROL_FAR | CONTROL_TERMINAL},
+	{"rsm", CONTROL_RET | CONTROL_FAR | CONTROL_TERMINAL},
+	{"_loop", CONTROL_LOOP}, {"_loopz", CONTROL_LOOP}, {"_loopnz", CONTROL_LOOP}, {"_jrcxz", CONTROL_LOOP},
+	{"int", CONTROL_INT | CONTROL_FAR},
+	{"_int3", CONTROL_INT | CONTROL_FAR},
+	{"_uint1", CONTROL_INT | CONTROL_FAR},
+	{"into", CONTROL_INT | CONTROL_FAR},
+	{"syscall", CONTROL_INT | CONTROL_FAR},
+	{"sysenter", CONTROL_INT | CONTROL_FAR},
+	{"hlt", CONTROL_HALT | CONTROL_TERMINAL},
+	{"ud2", CONTROL_HALT | CONTROL_TERMINAL},
+	{NULL, 0}
+};
+
+// Builds one entry per encoding for crudasm_intel_control_table[], so that
+// instructions can be classified without looking at their names.
+std::string IntelDecoderTableBuilder::buildControlTable(std::vector<U2> &table)
+{
+	size_t etag_relative = find_tag(x86->etags, "etag_relative");
+	size_t etag_sx_byte = find_tag(x86->etags, "etag_sx_byte");
+	size_t itag_ctrlxfer = find_tag(x86->itags, "itag_ctrlxfer");
+
+	table.clear();
+	size_t numEncodings = x86->getNumEncodings();
+	for(size_t e = 0; e < numEncodings; ++e)
+	{
+		AxiomCpuEncoding *encoding = x86->getEncoding(e);
+		std::string insn_name = *encoding->insn->alias;
+		U2 entry = CONTROL_NONE;
+
+		for(size_t i = 0; control_insns[i].name != NULL; ++i)
+		{
+			if(insn_name == control_insns[i].name)
+			{
+				entry = control_insns[i].entry;
+				break;
+			}
+		}
+
+		if((encoding->insn->insn_flags & itag_ctrlxfer) != 0 && entry == CONTROL_NONE)
+			return std::string("control table: unknown kind of control transfer, instruction: ") + insn_name;
+
+		if((encoding->etags & etag_relative) != 0)
+		{
+			if((entry & CONTROL_KIND) == CONTROL_NONE || (entry & (CONTROL_FAR | CONTROL_INDIRECT)) != 0)
+				return std::string("control table: unexpected relative encoding, instruction: ") + insn_name;
+			entry |= CONTROL_RELATIVE;
+			entry |= ((encoding->etags & etag_sx_byte) != 0) ? CONTROL_REL8 : CONTROL_REL_OSZ;
+		}
+
+		table.push_back(entry);
+	}
+
+	return "";	// success
+}
+
+// Argument sizes are resolved for every (dsz, osz, asz) that can occur; see
+// argsize_combo() in ../x86core/ixdecoder.c. 16 and 32 bit modes share
+// combinations 0..3 (2 * osz + asz), 64 bit mode has 4..9 (4 + 2 * osz + asz - 1).
+enum
+{
+	ARGSIZE_COMBOS = 10,
+	ARGSIZE_ROW = 0x0fff,		// crudasm_intel_argsize_index[]: row of crudasm_intel_argsize_rows[]
+	ARGSIZE_IMPLIED = 0x1000	// crudasm_intel_argsize_index[]: << n, argument n's size needn't be written
+};
+
+static void argsize_combo_sizes(int combo, int &dsz, int &osz, int &asz)
+{
+	if(combo < 4)
+	{
+		dsz = 1;
+		osz = combo >> 1;
+		asz = combo & 1;
+	}
+	else
+	{
+		dsz = 2;
+		osz = (combo - 4) >> 1;
+		asz = ((combo - 4) & 1) + 1;
+	}
+}
+
+// Builds crudasm_intel_argsize_rows[], the distinct sets of resolved argument
+// sizes, and crudasm_intel_argsize_index[], one entry per encoding. The
+// ARGSIZE_IMPLIED bits follow the disassembler's rule: a size needs writing
+// only if it's a parameter of the instruction (like P in mov(P x, P y)) and
+// no other argument that isn't an immediate has the same parameter.
+std::string IntelDecoderTableBuilder::buildArgSizeTable(std::vector<std::vector<signed char> > &rows, std::vector<U2> &index)
+{
+	std::map<std::vector<signed char>, size_t> row_map;
+
+	rows.clear();
+	index.clear();
+	size_t numEncodings = x86->getNumEncodings();
+	for(size_t e = 0; e < numEncodings; ++e)
+	{
+		AxiomCpuEncoding *encoding = x86->getEncoding(e);
+		AxiomCpuInsn *insn = encoding->insn;
+		std::vector<signed char> row(ARGSIZE_COMBOS * AXIOM_MAX_ASM_ARGS, 0);
+
+		for(int combo = 0; combo < ARGSIZE_COMBOS; ++combo)
+		{
+			int dsz, osz, asz;
+			argsize_combo_sizes(combo, dsz, osz, asz);
+			for(int i = 0; i < AXIOM_MAX_ASM_ARGS; ++i)
+			{
+				if(encoding->arg_sizes[i].isNull())
+					continue;
+				int bytes = intel_arg_size_bytes(encoding->arg_sizes[i]->getIdentifier()->getName(), dsz, osz, asz);
+				if(bytes > 127)
+					return std::string("argsize table: argument too large, instruction: ") + *insn->alias;
+				row[combo * AXIOM_MAX_ASM_ARGS + i] = static_cast<signed char>(bytes);
+			}
+		}
+
+		std::map<std::vector<signed char>, size_t>::iterator r = row_map.find(row);
+		size_t row_index;
+		if(r != row_map.end())
+			row_index = r->second;
+		else
+		{
+			row_index = rows.size();
+			if(row_index > ARGSIZE_ROW)
+				return "argsize table: too many distinct rows";
+			row_map[row] = row_index;
+			rows.push_back(row);
+		}
+
+		U2 entry = static_cast<U2>(row_index);
+		for(int i = 0; i < AXIOM_MAX_ASM_ARGS; ++i)
+		{
+			bool implied = true;
+			if(i < insn->numArgs && insn->argParamSize.find(insn->argSizes[i]) != insn->argParamSize.end())
+			{
+				implied = false;
+				for(int j = 0; j < insn->numArgs; ++j)
+				{
+					if(j == i || insn->argSizes[j] != insn->argSizes[i] || encoding->arg_types[j].isNull())
+						continue;
+					if(encoding->arg_types[j]->getIdentifier()->getName().compare(0, 4, "imm_") != 0)
+					{
+						implied = true;
+						break;
+					}
+				}
+			}
+			if(implied)
+				entry |= ARGSIZE_IMPLIED << i;
+		}
+		index.push_back(entry);
+	}
+
+	return "";	// success
+}
+
+// Builds crudasm_intel_encoding_hot_table[], the part of each encoding (and of
+// its instruction) that the decoder reads, packed into 16 bytes so that an
+// encoding never straddles a cache line.
+std::string IntelDecoderTableBuilder::buildHotTable(std::vector<HotEncodingT> &table, const std::vector<U2> &argsize_index)
+{
+	table.clear();
+	if(x86->cpuInsns.size() > 0xffff)
+		return "hot table: too many instructions";
+	size_t numEncodings = x86->getNumEncodings();
+	if(argsize_index.size() != numEncodings)
+		return "hot table: argsize index doesn't match the encodings";
+	for(size_t e = 0; e < numEncodings; ++e)
+	{
+		AxiomCpuEncoding *encoding = x86->getEncoding(e);
+		HotEncodingT entry;
+		if((encoding->etags >> 16) != 0)
+			return std::string("hot table: etags don't fit in 16 bits, instruction: ") + *encoding->insn->alias;
+		if((encoding->insn->insn_flags >> 8) != 0)
+			return std::string("hot table: itags don't fit in 8 bits, instruction: ") + *encoding->insn->alias;
+		entry.etags = static_cast<U2>(encoding->etags);
+		entry.argsize_index = argsize_index[e];
+		entry.itags = static_cast<U1>(encoding->insn->insn_flags);
+		entry.has_modrm = (info[encoding].regop != 0xf) ? 1 : 0;
+		table.push_back(entry);
+	}
+	return "";
+}
+
+// Code for one argument in a buildDecodeFuncs() function: what get_arguments()
+// does for an argument of the given type, given that its value is the default
+// one (only matters for registers). shift and rex say where a register number
+// comes from, as rm_reg_shift and rm_rex_reg do there.
+static std::string decode_func_arg(int i, std::string type, std::string value, bool value_is_default, bool sx_byte, bool imm64_disp,
+	bool imm64_sx32, bool reg_base, bool reg_rm, std::string shift, std::string rex, std::string tab, std::string &locals)
+{
+	std::string n = int_to_string(i);
+	std::string code;
+
+	if(type == "mem_fulldisp")
+	{
+		code += tab + "dest->has_disp = 1;\n";
+		code += tab + "state->disp_offset = (U1)(fetcher->next_offset);\n";
+		code += tab + "if(!fetch_le(fetcher, (U1)(2 << dest->asz), &value))\n";
+		code += tab + "\treturn crudasm_intel_status_limit_exceeded_7;\n";
+		code += tab + "dest->disp = (U4)(value);\n";
+		code += tab + "if(dest->asz == 2)\n";
+		code += tab + "\tdest->imm = (U4)((value >> 16) >> 16);\n";
+		if(locals.find("U8 value;") == std::string::npos)
+			locals += "\tU8 value;\n";
+	}
+	else
+	if(type == "imm_implict")
+		code += tab + "dest->imm = " + value + ";\n";
+	else
+	if(type.compare(0, 4, "imm_") == 0)
+	{
+		std::string imm_out = (type == "imm_2nd") ? "dest->disp" : "dest->imm";
+		code += tab + ((type == "imm_2nd") ? "state->imm2_offset" : "state->imm1_offset") + " = (U1)(fetcher->next_offset);\n";
+		if(sx_byte)
+		{
+			code += tab + "if(sizes[" + n + "] == 1)\n";
+			code += tab + "\treturn crudasm_intel_status_internal_error;\n";
+			code += tab + "dest->sx = 1;\n";
+			code += tab + "if(!fetch_byte(fetcher, &immvalue))\n";
+			code += tab + "\treturn crudasm_intel_status_limit_exceeded_8;\n";
+			code += tab + "accept_byte(fetcher);\n";
+			code += tab + "if(dest->osz == 0)\n";
+			code += tab + "\t" + imm_out + " = (U4)(U2)(S2)(S1)(immvalue);\n";
+			code += tab + "else\n";
+			code += tab + "\t" + imm_out + " = (U4)(S4)(S1)(immvalue);\n";
+			if(locals.find("U1 immvalue;") == std::string::npos)
+				locals += "\tU1 immvalue;\n";
+			return code;
+		}
+		std::string tab2 = tab;
+		if(imm64_disp)
+		{
+			code += tab + "if(sizes[" + n + "] == 8)\n";
+			code += tab + "{\n";
+			code += tab + "\tif(!fetch_le(fetcher, 8, &value))\n";
+			code += tab + "\t\treturn crudasm_intel_status_limit_exceeded_9;\n";
+			code += tab + "\tdest->imm = (U4)(value);\n";
+			code += tab + "\tdest->disp = (U4)((value >> 16) >> 16);\n";
+			code += tab + "\tdest->imm64 = 1;\n";
+			code += tab + "}\n";
+			code += tab + "else\n";
+			code += tab + "{\n";
+			tab2 = tab + "\t";
+		}
+		code += tab2 + "size = sizes[" + n + "];\n";
+		code += tab2 + "if(size == 8)\n";
+		if(imm64_sx32)
+			code += tab2 + "\tsize = 4;\n";
+		else
+			code += tab2 + "\treturn crudasm_intel_status_missing_imm64_sx32;\n";
+		code += tab2 + "if(!fetch_le(fetcher, (U1)(size), &value))\n";
+		code += tab2 + "\treturn crudasm_intel_status_limit_exceeded_10;\n";
+		code += tab2 + imm_out + " = (U4)(value);\n";
+		if(imm64_disp)
+			code += tab + "}\n";
+		if(locals.find("U8 value;") == std::string::npos)
+			locals += "\tU8 value;\n";
+		if(locals.find("S2 size;") == std::string::npos)
+			locals += "\tS2 size;\n";
+	}
+	else
+	if(type.compare(0, 4, "reg_") == 0 && value_is_default)
+	{
+		std::string arg = "dest->argvalue[" + n + "]";
+		if(type == "reg_sr")
+		{
+			code += tab + arg + " = (state->modrm0 >> 3) & 7;\n";
+			code += tab + "if(" + arg + " > 5)\n";
+			code += tab + "\treturn crudasm_intel_status_bad_sreg;\n";
+		}
+		else
+		if(reg_base)
+			code += tab + arg + " = (U1)(state->opcode0 & 7)" + ((type == "reg_gr") ? " + ((U1)(p->rex_b) << 3)" : "") + ";\n";
+		else
+		if(reg_rm)
+			code += tab + arg + " = (state->modrm0 & 7) + ((U1)(p->rex_b) << 3);\n";
+		else
+			code += tab + arg + " = ((state->modrm0 >> " + shift + ") & 7) + ((U1)(" + rex + ") << 3);\n";
+	}
+	return code;
+}
+
+// Builds the argument decoders written to out_intel_decode_funcs.h. Each is
+// get_arguments() in ixdecoder_mode.h worked through for one encoding, so that
+// it fetches exactly the operands the encoding has, with no tests on argument
+// types, values or etags left at run time. Encodings whose code comes out the
+// same share a function; func_index gets the function number of each encoding.
+std::string IntelDecoderTableBuilder::buildDecodeFuncs(std::vector<std::string> &funcs, std::vector<size_t> &func_index)
+{
+	size_t etag_sx_byte = find_tag(x86->etags, "etag_sx_byte");
+	size_t etag_imm64_disp = find_tag(x86->etags, "etag_imm64_disp");
+	size_t etag_imm64_sx32 = find_tag(x86->etags, "etag_imm64_sx32");
+	size_t etag_reg_rm = find_tag(x86->etags, "etag_reg_rm");
+	std::map<std::string, size_t> func_map;
+
+	if(etag_sx_byte == 0 || etag_imm64_disp == 0 || etag_imm64_sx32 == 0 || etag_reg_base == 0 || etag_reg_rm == 0)
+		return "decode funcs: missing etags";
+	funcs.clear();
+	func_index.clear();
+	size_t numEncodings = x86->getNumEncodings();
+	for(size_t e = 0; e < numEncodings; ++e)
+	{
+		AxiomCpuEncoding *encoding = x86->getEncoding(e);
+		std::string locals, init, code;
+		bool sx_byte = (encoding->etags & etag_sx_byte) != 0;
+		bool imm64_disp = (encoding->etags & etag_imm64_disp) != 0;
+		bool imm64_sx32 = (encoding->etags & etag_imm64_sx32) != 0;
+		bool reg_base = (encoding->etags & etag_reg_base) != 0;
+		bool reg_rm = (encoding->etags & etag_reg_rm) != 0;
+		bool done = false;
+
+		for(int i = 0; i < AXIOM_MAX_ASM_ARGS; ++i)
+		{
+			std::string n = int_to_string(i);
+			std::string type, value;
+			bool reg_or_mem = false;
+
+			if(!encoding->arg_types[i].isNull())
+				type = encoding->arg_types[i]->getIdentifier()->getName();
+			if(encoding->arg_values[i].isNull())
+				value = "crudasm_intel_argvalue_default";
+			else
+			if(encoding->arg_values[i]->getInteger() != NULL)
+				value = int_to_string((int)(encoding->arg_values[i]->getInteger()->getScalarValue()));
+			else
+			{
+				value = "crudasm_intel_argvalue_" + encoding->arg_values[i]->getIdentifier()->getName();
+				reg_or_mem = (value == "crudasm_intel_argvalue_reg_or_mem");
+			}
+
+			init += "\tdest->argtype[" + n + "] = " + (type.empty() ? std::string("crudasm_intel_argtype_void") : "crudasm_intel_argtype_" + type) + ";\n";
+			init += "\tdest->argsize[" + n + "] = sizes[" + n + "];\n";
+			init += "\tdest->argvalue[" + n + "] = " + value + ";\n";
+			if(type.empty())
+				done = true;
+			if(done)
+				continue;
+
+			code += "\n\tif(sizes[" + n + "] <= 0)\n";
+			code += "\t\treturn crudasm_intel_status_unsupported_argument;\n";
+			if(reg_or_mem)
+			{
+				std::string arg_code = decode_func_arg(i, type, "crudasm_intel_argvalue_default", true, sx_byte, imm64_disp, imm64_sx32, reg_base, reg_rm,
+					"0", "p->rex_b", "\t\t", locals);
+				code += "\tdest->argvalue[" + n + "] = crudasm_intel_argvalue_default;\n";
+				code += "\tif(state->modrm0 < 0xc0)\n";
+				code += "\t\tdest->argtype[" + n + "] = crudasm_intel_argtype_mem_ea;\n";
+				if(!arg_code.empty())
+				{
+					code += "\telse\n";
+					code += "\t{\n";
+					code += arg_code;
+					code += "\t}\n";
+				}
+			}
+			else
+				code += decode_func_arg(i, type, value, value == "crudasm_intel_argvalue_default", sx_byte, imm64_disp, imm64_sx32, reg_base, reg_rm,
+					"3", "p->rex_r", "\t", locals);
+		}
+
+		std::string body = locals + (locals.empty() ? "" : "\n") + init + code + "\n\treturn crudasm_intel_status_ok;\n";
+		std::map<std::string, size_t>::iterator f = func_map.find(body);
+		if(f == func_map.end())
+		{
+			f = func_map.insert(std::make_pair(body, funcs.size())).first;
+			funcs.push_back(body);
+		}
+		func_index.push_back(f->second);
+	}
+	return "";
+}
+
 std::string IntelDecoderTableBuilder::buildTable(std::vector<U4> &table)
 {
 	table.clear();
@@ -860,45 +1562,282 @@ std::string IntelDecoderTableBuilder::buildTable(std::vector<U4> &table)
 	return "";	// success
 }
 
-}	// namespace AxiomLanguage
+// Builds the flattened decoder table from a table made by buildTable(). It has
+// 6 rows of 512 entries, one row per prefix class (66 + 2 * (none, f2, f3)), one
+// entry per opcode (00..ff, then 0f 00..0f ff). Each entry is the node that the
+// decoder table walk reaches after the opcode bytes and any prefix splitter, so
+// most opcodes resolve to an encoding in a single lookup. Modr/m splitters, the
+// dsz splitter, 3DNow! and 3 byte opcodes are still left to the decoder table.
+std::string IntelDecoderTableBuilder::buildFlatTable(std::vector<U4> &flat, std::vector<U4> &table)
+{
+	flat.clear();
+	U4 root = table.back();
+	if((root >> 24) != 1 || (table[(root & 0xffffff) + 0x0f] >> 24) != 1)
+		return "flat table: unexpected decoder table layout";
+	U4 root_0f = table[(root & 0xffffff) + 0x0f] & 0xffffff;
 
-using namespace AxiomLanguage;
+	for(U4 prefix_class = 0; prefix_class < 6; ++prefix_class)
+	{
+		for(U4 opcode = 0; opcode < 0x200; ++opcode)
+		{
+			U4 node;
+			if(opcode == 0x0f)
+				node = 0x00ffffff;		// never used; 0f is always followed by another opcode byte
+			else
+			if(opcode < 0x100)
+				node = table[(root & 0xffffff) + opcode];
+			else
+				node = table[root_0f + (opcode & 0xff)];
+			if((node >> 24) == 2)
+				node = table[(node & 0xffffff) + prefix_class];
+			if((node >> 24) == 2)
+				return "flat table: nested prefix splitter";
+			flat.push_back(node);
+		}
+	}
 
-int main(int argc, char **argv)
+	return "";	// success
+}
+
+// crudasm_intel_decoder_table[] and crudasm_intel_decoder_flat_table[] entries,
+// as written by buildCompactTable().
+enum
 {
-	if(argc != 2)
+	DECODER_TYPE_SHIFT = 12,		// node type is in the high 4 bits
+	DECODER_OFFSET = 0xfff,			// node offset, or encoding number for type 0
+	DECODER_INVALID = 0xfff			// type 0 entry for an invalid opcode
+};
+
+// Builds the 16 bit decoder tables that get written out, from the tables made by
+// buildTable() and buildFlatTable(). Only nodes the flat table leads to are kept
+// (the decoder never walks the opcode byte nodes at the top), identical nodes are
+// stored once, and each 256 entry type 1 node is split into a 16 entry node for
+// the high nibble and one type 8 node per high nibble that has any valid opcode.
+// That way a run of 16 invalid opcodes costs a single entry.
+std::string IntelDecoderTableBuilder::buildCompactTable(std::vector<U2> &compact, std::vector<U2> &compact_flat, std::vector<U4> &table, std::vector<U4> &flat)
+{
+	std::map<U4, U2> done;
+	std::map<std::vector<U2>, U2> nodes;
+
+	compact.clear();
+	compact_flat.clear();
+	for(size_t i = 0; i < flat.size(); ++i)
 	{
-		std::cout << "Copyright (C) 2010-2012,2014 Willow Schlanger. All rights reserved." << std::endl;
-		std::cout << "Usage: makecpu <output path>" << std::endl;
-		std::cout << "Note: x86iset.ax must be in the current directory when this is run!" << std::endl;
-		doPause();
-		return 1;
+		U2 entry;
+		std::string status = compact_entry(entry, flat[i], table, compact, done, nodes);
+		if(status != "")
+			return status;
+		compact_flat.push_back(entry);
 	}
-	std::string path = argv[1];
-	for(std::string::iterator i = path.begin(); i != path.end(); ++i)
+	return "";
+}
+
+// Sets out to the compact form of a buildTable() entry, adding whatever nodes it
+// needs to compact.
+std::string IntelDecoderTableBuilder::compact_entry(U2 &out, U4 entry, std::vector<U4> &table, std::vector<U2> &compact, std::map<U4, U2> &done, std::map<std::vector<U2>, U2> &nodes)
+{
+	U4 type = entry >> 24;
+	U4 offset = entry & 0xffffff;
+	size_t size;
+
+	if(type == 0)
 	{
-		if(*i == '\\')
-			*i = '/';
+		if(offset == 0xffffff)
+			out = DECODER_INVALID;
+		else
+		if(offset >= DECODER_INVALID)
+			return "compact decoder table: too many encodings";
+		else
+			out = static_cast<U2>(offset);
+		return "";
 	}
-	if(!path.empty() && path[path.size()-1] != '/')
-		path += "/";
-	
-	using namespace std;
-	FILE *afi = fopen("x86iset.ax", "rb");
-	if(afi == NULL)
+
+	std::map<U4, U2>::iterator d = done.find(entry);
+	if(d != done.end())
 	{
-		std::cout << "Error: unable to open file for reading: x86iset.ax" << std::endl;
-		doPause();
-		return 1;
+		out = d->second;
+		return "";
 	}
-	fclose(afi);
-	afi = NULL;
 
-	try
+	switch(type)
 	{
-		AxiomState *aState = new AxiomState();
-		AxiomParser<std::string::iterator> parser(aState);
-		AxiomEvaluator eval(aState, std::cerr);
+	case 1:
+	case 7:
+		size = 256;
+		break;
+	case 2:
+		size = 6;
+		break;
+	case 3:
+		size = 32;
+		break;
+	case 4:
+	case 5:
+		size = 8;
+		break;
+	case 6:
+		size = 2;
+		break;
+	default:
+		return "compact decoder table: unknown node type";
+	}
+
+	std::vector<U2> node(size);
+	for(size_t i = 0; i < size; ++i)
+	{
+		std::string status = compact_entry(node[i], table[offset + i], table, compact, done, nodes);
+		if(status != "")
+			return status;
+	}
+
+	std::string status;
+	U2 node_offset;
+	if(type == 1)
+	{
+		std::vector<U2> high(16, DECODER_INVALID);
+		for(size_t h = 0; h < 16; ++h)
+		{
+			std::vector<U2> low(node.begin() + h * 16, node.begin() + h * 16 + 16);
+			if(low == std::vector<U2>(16, DECODER_INVALID))
+				continue;
+			status = compact_node(node_offset, low, compact, nodes);
+			if(status != "")
+				return status;
+			high[h] = static_cast<U2>((8 << DECODER_TYPE_SHIFT) | node_offset);
+		}
+		status = compact_node(node_offset, high, compact, nodes);
+	}
+	else
+		status = compact_node(node_offset, node, compact, nodes);
+	if(status != "")
+		return status;
+
+	out = static_cast<U2>((type << DECODER_TYPE_SHIFT) | node_offset);
+	done[entry] = out;
+	return "";
+}
+
+// Sets offset to where node is in compact, appending it if it isn't there yet.
+std::string IntelDecoderTableBuilder::compact_node(U2 &offset, std::vector<U2> &node, std::vector<U2> &compact, std::map<std::vector<U2>, U2> &nodes)
+{
+	std::map<std::vector<U2>, U2>::iterator n = nodes.find(node);
+	if(n != nodes.end())
+	{
+		offset = n->second;
+		return "";
+	}
+	if(compact.size() + node.size() > DECODER_OFFSET)
+		return "compact decoder table: too large for 12 bit offsets";
+	offset = static_cast<U2>(compact.size());
+	nodes[node] = offset;
+	compact.insert(compact.end(), node.begin(), node.end());
+	return "";
+}
+
+}	// namespace AxiomLanguage
+
+using namespace AxiomLanguage;
+
+// Register names, size keywords, prefixes and the mnemonics of the special
+// cases in intel_disasm_nasm.h that the disassembler writes, in
+// crudasm_intel_tokens[] order. An entry with a name starts a
+// crudasm_intel_token_<name> group (or is a token of its own).
+struct IntelTokenT
+{
+	const char *name;
+	const char *text;
+};
+
+static const IntelTokenT intel_tokens[] =
+{
+	// Note: reg8[16..19] are used only by implict registers, if the user wants to specify AH, CH, DH, or BH.
+	{"reg8", "al"}, {NULL, "cl"}, {NULL, "dl"}, {NULL, "bl"}, {NULL, "spl"}, {NULL, "bpl"}, {NULL, "sil"}, {NULL, "dil"},
+	{NULL, "r8b"}, {NULL, "r9b"}, {NULL, "r10b"}, {NULL, "r11b"}, {NULL, "r12b"}, {NULL, "r13b"}, {NULL, "r14b"}, {NULL, "r15b"},
+	{NULL, "ah"}, {NULL, "ch"}, {NULL, "dh"}, {NULL, "bh"},
+	{"reg8x86", "al"}, {NULL, "cl"}, {NULL, "dl"}, {NULL, "bl"}, {NULL, "ah"}, {NULL, "ch"}, {NULL, "dh"}, {NULL, "bh"},
+	{"reg16", "ax"}, {NULL, "cx"}, {NULL, "dx"}, {NULL, "bx"}, {NULL, "sp"}, {NULL, "bp"}, {NULL, "si"}, {NULL, "di"},
+	{NULL, "r8w"}, {NULL, "r9w"}, {NULL, "r10w"}, {NULL, "r11w"}, {NULL, "r12w"}, {NULL, "r13w"}, {NULL, "r14w"}, {NULL, "r15w"},
+	{"reg32", "eax"}, {NULL, "ecx"}, {NULL, "edx"}, {NULL, "ebx"}, {NULL, "esp"}, {NULL, "ebp"}, {NULL, "esi"}, {NULL, "edi"},
+	{NULL, "r8d"}, {NULL, "r9d"}, {NULL, "r10d"}, {NULL, "r11d"}, {NULL, "r12d"}, {NULL, "r13d"}, {NULL, "r14d"}, {NULL, "r15d"},
+	{"reg64", "rax"}, {NULL, "rcx"}, {NULL, "rdx"}, {NULL, "rbx"}, {NULL, "rsp"}, {NULL, "rbp"}, {NULL, "rsi"}, {NULL, "rdi"},
+	{NULL, "r8"}, {NULL, "r9"}, {NULL, "r10"}, {NULL, "r11"}, {NULL, "r12"}, {NULL, "r13"}, {NULL, "r14"}, {NULL, "r15"},
+	{"sreg", "es"}, {NULL, "cs"}, {NULL, "ss"}, {NULL, "ds"}, {NULL, "fs"}, {NULL, "gs"}, {NULL, "ss"}, {NULL, "ds"},
+	{"byte", "byte"}, {"word", "word"}, {"dword", "dword"}, {"qword", "qword"}, {"xword", "xword"}, {"tword", "tword"},
+	{"lock", "lock "}, {"rep", "rep "}, {"repnz", "repnz "}, {"repz", "repz "},
+	{"o16", "o16 "}, {"o32", "o32 "}, {"o64", "o64 "},
+	// The register groups below have 16 entries because the decoder adds the
+	// REX bits to every register number.
+	{"xmm", "xmm0"}, {NULL, "xmm1"}, {NULL, "xmm2"}, {NULL, "xmm3"}, {NULL, "xmm4"}, {NULL, "xmm5"}, {NULL, "xmm6"}, {NULL, "xmm7"},
+	{NULL, "xmm8"}, {NULL, "xmm9"}, {NULL, "xmm10"}, {NULL, "xmm11"}, {NULL, "xmm12"}, {NULL, "xmm13"}, {NULL, "xmm14"}, {NULL, "xmm15"},
+	{"mmx", "mm0"}, {NULL, "mm1"}, {NULL, "mm2"}, {NULL, "mm3"}, {NULL, "mm4"}, {NULL, "mm5"}, {NULL, "mm6"}, {NULL, "mm7"},
+	{NULL, "mm8"}, {NULL, "mm9"}, {NULL, "mm10"}, {NULL, "mm11"}, {NULL, "mm12"}, {NULL, "mm13"}, {NULL, "mm14"}, {NULL, "mm15"},
+	{"cr", "cr0"}, {NULL, "cr1"}, {NULL, "cr2"}, {NULL, "cr3"}, {NULL, "cr4"}, {NULL, "cr5"}, {NULL, "cr6"}, {NULL, "cr7"},
+	{NULL, "cr8"}, {NULL, "cr9"}, {NULL, "cr10"}, {NULL, "cr11"}, {NULL, "cr12"}, {NULL, "cr13"}, {NULL, "cr14"}, {NULL, "cr15"},
+	{"dr", "dr0"}, {NULL, "dr1"}, {NULL, "dr2"}, {NULL, "dr3"}, {NULL, "dr4"}, {NULL, "dr5"}, {NULL, "dr6"}, {NULL, "dr7"},
+	{NULL, "dr8"}, {NULL, "dr9"}, {NULL, "dr10"}, {NULL, "dr11"}, {NULL, "dr12"}, {NULL, "dr13"}, {NULL, "dr14"}, {NULL, "dr15"},
+	{"st", "st0"}, {NULL, "st1"}, {NULL, "st2"}, {NULL, "st3"}, {NULL, "st4"}, {NULL, "st5"}, {NULL, "st6"}, {NULL, "st7"},
+	{NULL, "st8"}, {NULL, "st9"}, {NULL, "st10"}, {NULL, "st11"}, {NULL, "st12"}, {NULL, "st13"}, {NULL, "st14"}, {NULL, "st15"},
+	{"short", "short "}, {"near", "near "}, {"far", "far "}, {"rel", "rel "}, {"section_plus", "$$+"},
+	{"aad", "aad"}, {"aam", "aam"}, {"call", "call"}, {"cmps", "cmps"}, {"cmpxchg", "cmpxchg"}, {"div", "div"},
+	{"fmul", "fmul"}, {"fxch", "fxch"}, {"idiv", "idiv"}, {"imul", "imul"}, {"in", "in"}, {"ins", "ins"},
+	{"int1", "int1"}, {"int3", "int3"}, {"iret", "iret"}, {"jmp", "jmp"}, {"lods", "lods"}, {"loop", "loop"},
+	{"loopnz", "loopnz"}, {"loopz", "loopz"}, {"mov", "mov"}, {"movs", "movs"}, {"movsd", "movsd"}, {"mul", "mul"},
+	{"nop", "nop"}, {"out", "out"}, {"outs", "outs"}, {"pop", "pop"}, {"popa", "popa"}, {"popf", "popf"},
+	{"push", "push"}, {"pusha", "pusha"}, {"pushf", "pushf"}, {"ret", "ret"}, {"retf", "retf"}, {"salc", "salc"},
+	{"scas", "scas"}, {"shl", "shl"}, {"stos", "stos"}, {"test", "test"}, {"xchg", "xchg"}, {"xlatb", "xlatb"},
+	// Indexed by osz, by asz, or by (osz == 2).
+	{"cbw", "cbw"}, {NULL, "cwde"}, {NULL, "cdqe"}, {"cwd", "cwd"}, {NULL, "cdq"}, {NULL, "cqo"},
+	{"jcxz", "jcxz"}, {NULL, "jecxz"}, {NULL, "jrcxz"},
+	{"cmpxchg8b", "cmpxchg8b"}, {NULL, "cmpxchg16b"}, {"fxrstor", "fxrstor"}, {NULL, "fxrstor64"},
+	{"fxsave", "fxsave"}, {NULL, "fxsave64"}
+};
+
+enum { TOKEN_MAX_LENGTH = 15 };		// length of crudasm_intel_token_t::text[]
+
+// Writes a crudasm_intel_token_t initializer. Returns false if text is too long.
+static bool write_token(std::ostream &fo, const std::string &text)
+{
+	if(text.size() > TOKEN_MAX_LENGTH)
+		return false;
+	fo << "{" << text.size() << ", \"" << text << "\"}";
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	if(argc != 2)
+	{
+		std::cout << "Copyright (C) 2010-2012,2014 Willow Schlanger. All rights reserved." << std::endl;
+		std::cout << "Usage: makecpu <output path>" << std::endl;
+		std::cout << "Note: x86iset.ax must be in the current directory when this is run!" << std::endl;
+		doPause();
+		return 1;
+	}
+	std::string path = argv[1];
+	for(std::string::iterator i = path.begin(); i != path.end(); ++i)
+	{
+		if(*i == '\\')
+			*i = '/';
+	}
+	if(!path.empty() && path[path.size()-1] != '/')
+		path += "/";
+	
+	using namespace std;
+	FILE *afi = fopen("x86iset.ax", "rb");
+	if(afi == NULL)
+	{
+		std::cout << "Error: unable to open file for reading: x86iset.ax" << std::endl;
+		doPause();
+		return 1;
+	}
+	fclose(afi);
+	afi = NULL;
+
+	try
+	{
+		AxiomState *aState = new AxiomState();
+		AxiomParser<std::string::iterator> parser(aState);
+		AxiomEvaluator eval(aState, std::cerr);
 		{
 			AxiomItem cpu = parser.parseIncludeFile("x86iset.ax", std::cerr);
 			if(cpu.isNull())
@@ -932,6 +1871,28 @@ int main(int argc, char **argv)
 				return 1;
 			}
 
+			std::vector<U4> flat_table;
+			status = builder.buildFlatTable(flat_table, table);
+			if(status != "")
+			{
+				cpu.clear();
+				std::cout << "Error: " << status << std::endl;
+				delete aState;
+				doPause();
+				return 1;
+			}
+
+			std::vector<U2> compact_table, compact_flat_table;
+			status = builder.buildCompactTable(compact_table, compact_flat_table, table, flat_table);
+			if(status != "")
+			{
+				cpu.clear();
+				std::cout << "Error: " << status << std::endl;
+				delete aState;
+				doPause();
+				return 1;
+			}
+
 			{
 				std::ofstream fo((path + "out_intel_decoder_table.h").c_str());
 				if(fo == NULL)
@@ -944,8 +1905,113 @@ int main(int argc, char **argv)
 				}
 				fo << "// out_intel_decoder_table.h  (note: this file was automatically generated -- do not edit!)\n";
 				fo << "// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.\n";
-				fo << "\nU4 crudasm_intel_decoder_table[] = {";
-				for(size_t i = 0; i < table.size(); ++i)
+				fo << "\nCRUDASM_TABLE_ALIGN const U2 crudasm_intel_decoder_table[] = {";
+				for(size_t i = 0; i < compact_table.size(); ++i)
+				{
+					if(i != 0)
+						fo << ",";
+					if(i % 16 == 0)
+					{
+						fo << "\n\t";
+					}
+					fo << "0x" << std::hex << compact_table[i] << std::dec;
+				}
+				fo << "\n";
+				fo << "};\n";
+
+				fo << "\nCRUDASM_TABLE_ALIGN const U2 crudasm_intel_decoder_flat_table[] = {";
+				for(size_t i = 0; i < compact_flat_table.size(); ++i)
+				{
+					if(i != 0)
+						fo << ",";
+					if(i % 16 == 0)
+					{
+						fo << "\n\t";
+					}
+					fo << "0x" << std::hex << compact_flat_table[i] << std::dec;
+				}
+				fo << "\n";
+				fo << "};\n";
+				fo << std::endl;
+			}
+
+			{
+				std::vector<U4> length_table, length_opcode_table;
+				status = builder.buildLengthTable(length_table, length_opcode_table, table);
+				if(status != "")
+				{
+					cpu.clear();
+					std::cout << "Error: " << status << std::endl;
+					delete aState;
+					doPause();
+					return 1;
+				}
+
+				std::ofstream fo((path + "out_intel_length_table.h").c_str());
+				if(fo == NULL)
+				{
+					std::cout << "Error: unable to create file: " << path << "out_intel_length_table.h" << std::endl;
+					cpu.clear();
+					delete aState;
+					doPause();
+					return 1;
+				}
+				fo << "// out_intel_length_table.h  (note: this file was automatically generated -- do not edit!)\n";
+				fo << "// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.\n";
+				fo << "\nCRUDASM_TABLE_ALIGN const U4 crudasm_intel_length_table[] = {";
+				for(size_t i = 0; i < length_table.size(); ++i)
+				{
+					if(i != 0)
+						fo << ",";
+					if(i % 8 == 0)
+					{
+						fo << "\n\t";
+					}
+					fo << "0x" << std::hex << length_table[i] << std::dec;
+				}
+				fo << "\n";
+				fo << "};\n";
+				fo << "\nCRUDASM_TABLE_ALIGN const U4 crudasm_intel_length_opcode_table[] = {";
+				for(size_t i = 0; i < length_opcode_table.size(); ++i)
+				{
+					if(i != 0)
+						fo << ",";
+					if(i % 8 == 0)
+					{
+						fo << "\n\t";
+					}
+					fo << "0x" << std::hex << length_opcode_table[i] << std::dec;
+				}
+				fo << "\n";
+				fo << "};\n";
+				fo << std::endl;
+			}
+
+			{
+				std::vector<U2> control_table;
+				status = builder.buildControlTable(control_table);
+				if(status != "")
+				{
+					cpu.clear();
+					std::cout << "Error: " << status << std::endl;
+					delete aState;
+					doPause();
+					return 1;
+				}
+
+				std::ofstream fo((path + "out_intel_control_table.h").c_str());
+				if(fo == NULL)
+				{
+					std::cout << "Error: unable to create file: " << path << "out_intel_control_table.h" << std::endl;
+					cpu.clear();
+					delete aState;
+					doPause();
+					return 1;
+				}
+				fo << "// out_intel_control_table.h  (note: this file was automatically generated -- do not edit!)\n";
+				fo << "// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.\n";
+				fo << "\nconst U2 crudasm_intel_control_table[] = {";
+				for(size_t i = 0; i < control_table.size(); ++i)
 				{
 					if(i != 0)
 						fo << ",";
@@ -953,10 +2019,197 @@ int main(int argc, char **argv)
 					{
 						fo << "\n\t";
 					}
-					if(i == 0)
-						fo << "0x" << std::hex << table[table.size() - 1] << std::dec;
+					fo << "0x" << std::hex << control_table[i] << std::dec;
+				}
+				fo << "\n";
+				fo << "};\n";
+				fo << std::endl;
+			}
+
+			std::vector<U2> argsize_index;
+			{
+				std::vector<std::vector<signed char> > argsize_rows;
+				status = builder.buildArgSizeTable(argsize_rows, argsize_index);
+				if(status != "")
+				{
+					cpu.clear();
+					std::cout << "Error: " << status << std::endl;
+					delete aState;
+					doPause();
+					return 1;
+				}
+
+				std::ofstream fo((path + "out_intel_argsize_table.h").c_str());
+				if(fo == NULL)
+				{
+					std::cout << "Error: unable to create file: " << path << "out_intel_argsize_table.h" << std::endl;
+					cpu.clear();
+					delete aState;
+					doPause();
+					return 1;
+				}
+				fo << "// out_intel_argsize_table.h  (note: this file was automatically generated -- do not edit!)\n";
+				fo << "// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.\n";
+				fo << "\nCRUDASM_TABLE_ALIGN const S1 crudasm_intel_argsize_rows[][CRUDASM_ARGSIZE_COMBOS][CRUDASM_MAX_ASM_ARGS] = {";
+				for(size_t i = 0; i < argsize_rows.size(); ++i)
+				{
+					if(i != 0)
+						fo << ",";
+					fo << "\n\t{";
+					for(int combo = 0; combo < ARGSIZE_COMBOS; ++combo)
+					{
+						if(combo != 0)
+							fo << ",";
+						fo << "{";
+						for(int k = 0; k < AXIOM_MAX_ASM_ARGS; ++k)
+						{
+							if(k != 0)
+								fo << ",";
+							fo << (int)(argsize_rows[i][combo * AXIOM_MAX_ASM_ARGS + k]);
+						}
+						fo << "}";
+					}
+					fo << "}";
+				}
+				fo << "\n";
+				fo << "};\n";
+				fo << "\nconst U2 crudasm_intel_argsize_index[] = {";
+				for(size_t i = 0; i < argsize_index.size(); ++i)
+				{
+					if(i != 0)
+						fo << ",";
+					if(i % 16 == 0)
+					{
+						fo << "\n\t";
+					}
+					fo << "0x" << std::hex << argsize_index[i] << std::dec;
+				}
+				fo << "\n";
+				fo << "};\n";
+				fo << std::endl;
+			}
+
+			{
+				std::vector<HotEncodingT> hot_table;
+				status = builder.buildHotTable(hot_table, argsize_index);
+				if(status != "")
+				{
+					cpu.clear();
+					std::cout << "Error: " << status << std::endl;
+					delete aState;
+					doPause();
+					return 1;
+				}
+
+				std::ofstream fo((path + "out_intel_hot_table.h").c_str());
+				if(fo == NULL)
+				{
+					std::cout << "Error: unable to create file: " << path << "out_intel_hot_table.h" << std::endl;
+					cpu.clear();
+					delete aState;
+					doPause();
+					return 1;
+				}
+				fo << "// out_intel_hot_table.h  (note: this file was automatically generated -- do not edit!)\n";
+				fo << "// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.\n";
+				fo << "\nCRUDASM_TABLE_ALIGN const struct crudasm_intel_encoding_hot_t crudasm_intel_encoding_hot_table[] = {\n";
+
+				AxiomItemCpuArch *x86 = cpu->getCpuArch();
+				for(size_t i = 0; i < hot_table.size(); ++i)
+				{
+					if(i != 0)
+						fo << ",\n";
+					fo << "\t";
+					AxiomCpuEncoding *encoding = x86->getEncoding(i);
+
+					fo << "{";
+					fo << std::hex;
+
+					fo << "{";
+					for(int k = 0; k < AXIOM_MAX_ASM_ARGS; ++k)
+					{
+						if(k != 0)
+							fo << ",";
+						if(encoding->arg_types[k].isNull())
+							fo << "0";
+						else
+							fo << "crudasm_intel_argtype_" << encoding->arg_types[k]->getIdentifier()->getName();
+					}
+					fo << "},";
+
+					fo << "{";
+					for(int k = 0; k < AXIOM_MAX_ASM_ARGS; ++k)
+					{
+						if(k != 0)
+							fo << ",";
+						if(encoding->arg_values[k].isNull())
+							fo << "crudasm_intel_argvalue_default";
+						else
+						if(encoding->arg_values[k]->getInteger() != NULL)
+							fo << "0x" << encoding->arg_values[k]->getInteger()->getScalarValue();
+						else
+							fo << "crudasm_intel_argvalue_" << encoding->arg_values[k]->getIdentifier()->getName();
+					}
+					fo << "},";
+
+					fo << "crudasm_intel_insn_" << *encoding->insn->alias << ", ";
+					fo << "0x" << hot_table[i].etags << ", ";
+					fo << "0x" << hot_table[i].argsize_index << ", ";
+					fo << "0x" << (U4)(hot_table[i].itags) << ", ";
+					fo << (U4)(hot_table[i].has_modrm);
+
+					fo << std::dec << "}";
+				}
+				fo << "\n";
+				fo << "};\n";
+				fo << std::endl;
+			}
+
+			{
+				std::vector<std::string> decode_funcs;
+				std::vector<size_t> decode_func_index;
+				status = builder.buildDecodeFuncs(decode_funcs, decode_func_index);
+				if(status != "")
+				{
+					cpu.clear();
+					std::cout << "Error: " << status << std::endl;
+					delete aState;
+					doPause();
+					return 1;
+				}
+
+				std::ofstream fo((path + "out_intel_decode_funcs.h").c_str());
+				if(fo == NULL)
+				{
+					std::cout << "Error: unable to create file: " << path << "out_intel_decode_funcs.h" << std::endl;
+					cpu.clear();
+					delete aState;
+					doPause();
+					return 1;
+				}
+				fo << "// out_intel_decode_funcs.h  (note: this file was automatically generated -- do not edit!)\n";
+				fo << "// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.\n";
+				fo << "// Not a normal header: ixdecoder_mode.h includes it once per mode when CRUDASM_COMPILED_ARGS\n";
+				fo << "// is defined. Each function does what get_arguments() does for the encodings that use it.\n";
+				for(size_t i = 0; i < decode_funcs.size(); ++i)
+				{
+					fo << "\nstatic int IXDEC_NAME(decode_args_" << i << ")(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes)\n";
+					fo << "{\n";
+					fo << decode_funcs[i];
+					fo << "}\n";
+				}
+				fo << "\nstatic const decode_args_func_t IXDEC_NAME(decode_args)[] = {";
+				for(size_t i = 0; i < decode_func_index.size(); ++i)
+				{
+					if(i != 0)
+						fo << ",";
+					if(i % 4 == 0)
+					{
+						fo << "\n\t";
+					}
 					else
-						fo << "0x" << std::hex << table[i - 1] << std::dec;
+						fo << " ";
+					fo << "IXDEC_NAME(decode_args_" << decode_func_index[i] << ")";
 				}
 				fo << "\n";
 				fo << "};\n";
@@ -975,7 +2228,7 @@ int main(int argc, char **argv)
 				}
 				fo << "// out_intel_encoding_table.h  (note: this file was automatically generated -- do not edit!)\n";
 				fo << "// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.\n";
-				fo << "\nstruct crudasm_intel_encoding_t crudasm_intel_encoding_table[] = {\n";
+				fo << "\nconst struct crudasm_intel_encoding_t crudasm_intel_encoding_table[] = {\n";
 		
 				AxiomItemCpuArch *x86 = cpu->getCpuArch();
 				size_t numEncodings = x86->getNumEncodings();
@@ -1066,6 +2319,14 @@ int main(int argc, char **argv)
 				fo2 << "// Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.\n";
 
 				fo2 << "\nenum { CRUDASM_MAX_ASM_ARGS = " << AXIOM_MAX_ASM_ARGS << " };\n";
+				fo2 << "enum { CRUDASM_ARGSIZE_COMBOS = " << ARGSIZE_COMBOS << " };\t// (dsz, osz, asz) combinations in crudasm_intel_argsize_rows[]\n";
+
+				fo2 << "\n// The tables the decoder reads start on a cache line.\n";
+				fo2 << "#ifdef _MSC_VER\n";
+				fo2 << "#define CRUDASM_TABLE_ALIGN __declspec(align(64))\n";
+				fo2 << "#else\n";
+				fo2 << "#define CRUDASM_TABLE_ALIGN __attribute__((aligned(64)))\n";
+				fo2 << "#endif\n";
 		
 				fo2 << "\n";
 				fo2 << "struct crudasm_intel_encoding_t {\n";
@@ -1083,11 +2344,30 @@ int main(int argc, char **argv)
 				fo2 << "\tU1 argvalue[CRUDASM_MAX_ASM_ARGS];\t// usually 0..127; default value is 0x80, 0x81 means reg_or_mem\n";
 				fo2 << "\tU4 etags;\t// encoding tags\n";
 				fo2 << "};\n";
+				fo2 << "\n// The decoder's part of crudasm_intel_encoding_table[] and crudasm_intel_insns[], 16 bytes\n";
+				fo2 << "// per encoding in a 64 byte aligned table. The full records are for the assembler and for\n";
+				fo2 << "// anything that needs the opcode bytes.\n";
+				fo2 << "struct crudasm_intel_encoding_hot_t {\n";
+				fo2 << "\tU1 argtype[CRUDASM_MAX_ASM_ARGS];\t// as in crudasm_intel_encoding_t\n";
+				fo2 << "\tU1 argvalue[CRUDASM_MAX_ASM_ARGS];\t// as in crudasm_intel_encoding_t\n";
+				fo2 << "\tU2 insn;\t// instruction number (index)\n";
+				fo2 << "\tU2 etags;\t// encoding tags\n";
+				fo2 << "\tU2 argsize_index;\t// same as crudasm_intel_argsize_index[]\n";
+				fo2 << "\tU1 itags;\t// instruction tags\n";
+				fo2 << "\tU1 has_modrm;\t// regop != f\n";
+				fo2 << "};\n";
 				fo2 << "\n#ifdef __cplusplus\n";
 				fo2 << "extern \"C\" {\n";
 				fo2 << "#endif\n";
-				fo2 << "\nextern struct crudasm_intel_encoding_t crudasm_intel_encoding_table[];  /* see out_intel_encoding_table.h */\n";
-				fo2 << "\nextern U4 crudasm_intel_decoder_table[];  /* see out_intel_decoder_table.h */\n";
+				fo2 << "\nextern const struct crudasm_intel_encoding_t crudasm_intel_encoding_table[];  /* see out_intel_encoding_table.h */\n";
+				fo2 << "extern const struct crudasm_intel_encoding_hot_t crudasm_intel_encoding_hot_table[];  /* see out_intel_hot_table.h */\n";
+				fo2 << "\nextern const U2 crudasm_intel_decoder_table[];  /* see out_intel_decoder_table.h */\n";
+				fo2 << "extern const U2 crudasm_intel_decoder_flat_table[];  /* see out_intel_decoder_table.h; [6 * 512] */\n";
+				fo2 << "\nextern const U4 crudasm_intel_length_table[];  /* see out_intel_length_table.h */\n";
+				fo2 << "extern const U4 crudasm_intel_length_opcode_table[];  /* see out_intel_length_table.h */\n";
+				fo2 << "\nextern const U2 crudasm_intel_control_table[];  /* see out_intel_control_table.h */\n";
+				fo2 << "\nextern const S1 crudasm_intel_argsize_rows[][CRUDASM_ARGSIZE_COMBOS][CRUDASM_MAX_ASM_ARGS];  /* see out_intel_argsize_table.h */\n";
+				fo2 << "extern const U2 crudasm_intel_argsize_index[];  /* see out_intel_argsize_table.h */\n";
 				fo2 << "\n#ifdef __cplusplus\n";
 				fo2 << "}\n";
 				fo2 << "#endif\n";
@@ -1116,6 +2396,67 @@ int main(int argc, char **argv)
 				}
 				fo2 << "\tcrudasm_intel_itagcount = " << x86->itags.size() << "\n};\n";
 
+				fo2 << "\n// crudasm_intel_decoder_table[] and crudasm_intel_decoder_flat_table[] entries: the node type\n";
+				fo2 << "// is in the high 4 bits, and the low 12 bits hold the node's offset in crudasm_intel_decoder_table[]\n";
+				fo2 << "// (for type 0, the encoding number, or crudasm_intel_decoder_invalid).\n";
+				fo2 << "enum {\n";
+				fo2 << std::hex;
+				fo2 << "\tcrudasm_intel_decoder_type_shift = " << std::dec << DECODER_TYPE_SHIFT << std::hex << ",\n";
+				fo2 << "\tcrudasm_intel_decoder_offset = 0x" << DECODER_OFFSET << ",\n";
+				fo2 << "\tcrudasm_intel_decoder_invalid = 0x" << DECODER_INVALID << "\n";
+				fo2 << std::dec;
+				fo2 << "};\n";
+
+				fo2 << "\n// crudasm_intel_length_table[] entries: the low 24 bits hold the number of immediate\n";
+				fo2 << "// bytes (0xf = invalid) in 6 nibbles: o16, o32 in 16/32 bit mode, then (66 + 2*rex.w)\n";
+				fo2 << "// in 64 bit mode. The high 8 bits are flags. crudasm_intel_length_opcode_table[] has the\n";
+				fo2 << "// same kind of entries for opcodes 00..ff and 0f 00..0f ff, where the opcode alone decides.\n";
+				fo2 << "enum {\n";
+				fo2 << std::hex;
+				fo2 << "\tcrudasm_intel_length_modrm = 0x" << LENGTH_MODRM << ",\n";
+				fo2 << "\tcrudasm_intel_length_no64 = 0x" << LENGTH_NO64 << ",\n";
+				fo2 << "\tcrudasm_intel_length_fulldisp = 0x" << LENGTH_FULLDISP << ",\n";
+				fo2 << "\tcrudasm_intel_length_lock_mem = 0x" << LENGTH_LOCK_MEM << ",\n";
+				fo2 << "\tcrudasm_intel_length_lock_rm = 0x" << LENGTH_LOCK_RM << ",\n";
+				fo2 << "\tcrudasm_intel_length_sreg = 0x" << LENGTH_SREG << ",\n";
+				fo2 << "\tcrudasm_intel_length_fwaitable = 0x" << LENGTH_FWAITABLE << ",\n";
+				fo2 << "\tcrudasm_intel_length_tree = 0x" << LENGTH_TREE << "\t// crudasm_intel_length_opcode_table[] only\n";
+				fo2 << std::dec;
+				fo2 << "};\n";
+
+				fo2 << "\n// crudasm_intel_control_table[] entries, one per encoding: the low 4 bits hold the kind of\n";
+				fo2 << "// control transfer (crudasm_intel_control_none if the encoding just goes on to the next\n";
+				fo2 << "// instruction), and the rest are flags.\n";
+				fo2 << "enum {\n";
+				fo2 << std::hex;
+				fo2 << "\tcrudasm_intel_control_none = 0x" << CONTROL_NONE << ",\n";
+				fo2 << "\tcrudasm_intel_control_jcc = 0x" << CONTROL_JCC << ",\n";
+				fo2 << "\tcrudasm_intel_control_jmp = 0x" << CONTROL_JMP << ",\n";
+				fo2 << "\tcrudasm_intel_control_call = 0x" << CONTROL_CALL << ",\n";
+				fo2 << "\tcrudasm_intel_control_ret = 0x" << CONTROL_RET << ",\n";
+				fo2 << "\tcrudasm_intel_control_loop = 0x" << CONTROL_LOOP << ",\t// loop, loopz, loopnz, jcxz\n";
+				fo2 << "\tcrudasm_intel_control_int = 0x" << CONTROL_INT << ",\t// software interrupts and system calls\n";
+				fo2 << "\tcrudasm_intel_control_halt = 0x" << CONTROL_HALT << ",\t// hlt, ud2\n";
+				fo2 << "\tcrudasm_intel_control_kind = 0x" << CONTROL_KIND << ",\t// mask for the above\n";
+				fo2 << "\tcrudasm_intel_control_relative = 0x" << CONTROL_RELATIVE << ",\t// target is relative to the next instruction\n";
+				fo2 << "\tcrudasm_intel_control_far = 0x" << CONTROL_FAR << ",\t// changes cs\n";
+				fo2 << "\tcrudasm_intel_control_indirect = 0x" << CONTROL_INDIRECT << ",\t// target comes from a register or memory\n";
+				fo2 << "\tcrudasm_intel_control_terminal = 0x" << CONTROL_TERMINAL << ",\t// never goes on to the next instruction\n";
+				fo2 << "\tcrudasm_intel_control_rel8 = 0x" << CONTROL_REL8 << ",\t// relative target is a sign-extended byte\n";
+				fo2 << "\tcrudasm_intel_control_rel_osz = 0x" << CONTROL_REL_OSZ << "\t// relative target is operand-sized (32 bits in 64 bit mode)\n";
+				fo2 << std::dec;
+				fo2 << "};\n";
+
+				fo2 << "\n// crudasm_intel_argsize_index[] entries, one per encoding: the low 12 bits select a row of\n";
+				fo2 << "// crudasm_intel_argsize_rows[], which has the argument sizes resolved for each (dsz, osz, asz).\n";
+				fo2 << "// Bit (12 + n) is set if the size of argument n goes without saying when disassembling.\n";
+				fo2 << "enum {\n";
+				fo2 << std::hex;
+				fo2 << "\tcrudasm_intel_argsize_row = 0x" << ARGSIZE_ROW << ",\n";
+				fo2 << "\tcrudasm_intel_argsize_implied = 0x" << ARGSIZE_IMPLIED << "\t// << argument number\n";
+				fo2 << std::dec;
+				fo2 << "};\n";
+
 				fo2 << "\nstruct crudasm_intel_insn_t {\n";
 				fo2 << "\tconst char *alias;\n";
 				fo2 << "\tU4 itags;\t// instruction tags\n";
@@ -1124,12 +2465,21 @@ int main(int argc, char **argv)
 				fo2 << "\tU4 last_encoding_index;\n";
 				fo2 << "\tU1 numArgs;\n";
 				fo2 << "\tS1 argSizes[CRUDASM_MAX_ASM_ARGS];\n";
+				fo2 << "};\n";
+
+				fo2 << "\n// Text the disassembler writes, with its length worked out in advance. text is padded with '\\0'\n";
+				fo2 << "// but needn't end with one.\n";
+				fo2 << "struct crudasm_intel_token_t {\n";
+				fo2 << "\tU1 length;\n";
+				fo2 << "\tchar text[" << TOKEN_MAX_LENGTH << "];\n";
 				fo2 << "};\n\n";
 
 				fo2 << "\n#ifdef __cplusplus\n";
 				fo2 << "extern \"C\" {\n";
 				fo2 << "#endif\n";
-				fo2 << "\nextern struct crudasm_intel_insn_t crudasm_intel_insns[];  /* see out_intel_encoding_table.h */\n";
+				fo2 << "\nextern const struct crudasm_intel_insn_t crudasm_intel_insns[];  /* see out_intel_encoding_table.h */\n";
+				fo2 << "\nextern const struct crudasm_intel_token_t crudasm_intel_insn_tokens[];  /* see out_intel_token_table.h; alias of each crudasm_intel_insns[] entry */\n";
+				fo2 << "extern const struct crudasm_intel_token_t crudasm_intel_tokens[];  /* see out_intel_token_table.h */\n";
 				fo2 << "\n#ifdef __cplusplus\n";
 				fo2 << "}\n";
 				fo2 << "#endif\n";
@@ -1143,6 +2493,16 @@ int main(int argc, char **argv)
 				}
 				fo2 << "\tcrudasm_intel_modecount\n};\n";
 
+				fo2 << "\n// crudasm_intel_tokens[] indices. Register groups are indexed by register number.\n";
+				fo2 << "enum {\n";
+				for(size_t i = 0; i < sizeof(intel_tokens) / sizeof(intel_tokens[0]); ++i)
+				{
+					if(intel_tokens[i].name != NULL)
+						fo2 << "\tcrudasm_intel_token_" << intel_tokens[i].name << " = " << i << ",\n";
+				}
+				fo2 << "\tcrudasm_intel_token__count = " << sizeof(intel_tokens) / sizeof(intel_tokens[0]) << "\n";
+				fo2 << "};\n";
+
 				fo2 << std::endl;
 
 				std::ofstream fo3((path + "out_intel_insn_table.h").c_str());
@@ -1155,7 +2515,7 @@ int main(int argc, char **argv)
 				}
 				fo3 << "// out_intel_insn_table.h  (note: this file was automatically generated -- do not edit!)\n";
 				fo3 << "// Copyright (C) 2012 Willow Schlanger. All rights reserved.\n\n";
-				fo3 << "struct crudasm_intel_insn_t crudasm_intel_insns[] = {\n";
+				fo3 << "const struct crudasm_intel_insn_t crudasm_intel_insns[] = {\n";
 				for(std::map<std::string, AxiomCpuInsn>::iterator i = x86->cpuInsns.begin(); i != x86->cpuInsns.end(); ++i)
 				{
 					fo3 << "\t{";
@@ -1205,6 +2565,49 @@ int main(int argc, char **argv)
 				fo3 << "\t{0}\n};\n";
 				fo3 << std::endl;
 
+				std::ofstream fo5((path + "out_intel_token_table.h").c_str());
+				if(fo5 == NULL)
+				{
+					std::cout << "Error: unable to create file: " << path << "out_intel_token_table.h" << std::endl;
+					cpu.clear();
+					delete aState;
+					doPause();
+					return 1;
+				}
+				fo5 << "// out_intel_token_table.h  (note: this file was automatically generated -- do not edit!)\n";
+				fo5 << "// Copyright (C) 2012 Willow Schlanger. All rights reserved.\n";
+				fo5 << "\nCRUDASM_TABLE_ALIGN const struct crudasm_intel_token_t crudasm_intel_insn_tokens[] = {\n";
+				for(std::map<std::string, AxiomCpuInsn>::iterator i = x86->cpuInsns.begin(); i != x86->cpuInsns.end(); ++i)
+				{
+					fo5 << "\t";
+					if(!write_token(fo5, *i->second.alias))
+					{
+						std::cout << "Error: token table: alias too long, instruction: " << *i->second.alias << std::endl;
+						cpu.clear();
+						delete aState;
+						doPause();
+						return 1;
+					}
+					fo5 << ",\n";
+				}
+				fo5 << "\t{0}\n};\n";
+				fo5 << "\nCRUDASM_TABLE_ALIGN const struct crudasm_intel_token_t crudasm_intel_tokens[] = {";
+				for(size_t i = 0; i < sizeof(intel_tokens) / sizeof(intel_tokens[0]); ++i)
+				{
+					if(i != 0)
+						fo5 << ",";
+					if(i % 8 == 0)
+					{
+						fo5 << "\n\t";
+					}
+					else
+						fo5 << " ";
+					write_token(fo5, intel_tokens[i].text);
+				}
+				fo5 << "\n";
+				fo5 << "};\n";
+				fo5 << std::endl;
+
 				std::ofstream fo4((path + "out_intel_disasm_nasm.h").c_str());
 				if(fo4 == NULL)
 				{
@@ -1255,7 +2658,7 @@ int main(int argc, char **argv)
 						else
 						{
 							fo4 << "\t\t\t{\n";
-							fo4 << "\t\t\t\tixdis1_write(context, \"" << insn.disasm_second_name << "\");\n";
+							fo4 << "\t\t\t\tixdis2_write_n(context, \"" << insn.disasm_second_name << "\", " << insn.disasm_second_name.size() << ");\n";
 							fo4 << "\t\t\t\tixdis0_write_any_args(context);\n";
 							fo4 << "\t\t\t\treturn 1;\t// handled\n";
 							fo4 << "\t\t\t}\n";
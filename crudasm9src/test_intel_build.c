@@ -15,8 +15,13 @@
 #include "crudasm_intel_include.h"
 
 #include "generated/out_intel_encoding_table.h"
+#include "generated/out_intel_hot_table.h"
 #include "generated/out_intel_decoder_table.h"
+#include "generated/out_intel_length_table.h"
+#include "generated/out_intel_control_table.h"
+#include "generated/out_intel_argsize_table.h"
 #include "generated/out_intel_insn_table.h"
+#include "generated/out_intel_token_table.h"
 
 int main(int argc, char **argv)
 {
@@ -8,61 +8,119 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stddef.h>
+#include <string.h>
 
-int disassemble_buffer(U1 *fd, long fs, U1 dsz, U8 origin, FILE *fout)
+// Number of instructions to decode per crudasm_intel_decode_batch() call.
+#define CRUDBIN_BATCH_SIZE 256
+
+// Number of bytes to read at a time when disassembling stdin.
+#define CRUDBIN_CHUNK_SIZE 65536
+
+static void write_header(U1 dsz, U8 origin, FILE *fout)
 {
-	char disasm_line[1024];
-	const char *status;
-	struct ix_icode_t icode;
-	struct ix_decoder_state_t state;
-	U8 insn_size;
-	U8 start_origin = origin;
-	
 	if(dsz == 2)
 		fprintf(fout, "; org 0x%08x%08x\n", (U4)((origin >> 16) >> 16), (U4)(origin));
 	else	
 		fprintf(fout, "; org 0x%08x\n", (U4)(origin));
 	fprintf(fout, "bits %d\n", 16 << dsz);
+}
+
+// Writes one line of output. first_byte is the first byte of the instruction;
+// that's all we print if icode->encoding is 0xffffffff (error decoding).
+static void write_insn(struct ix_icode_t *icode, U8 address, U1 size, U1 first_byte, const char *status, U1 dsz, FILE *fout)
+{
+	char disasm_line[1024];
+
+	if(icode->encoding == 0xffffffff)
+	{
+		// Error decoding.
+		fprintf(fout, "db 0x%02x\t; %s\n", (U4)(first_byte), status);
+		return;
+	}
+	
+	crudasm_intel_disasm_n(icode, address + size, disasm_line, sizeof(disasm_line), NULL, NULL, dsz);
+	
+	fprintf(fout, "loc_");
+	if(dsz == 2)
+	{
+		fprintf(fout, "%08x%08x", (U4)((address >> 16) >> 16), (U4)(address));
+	}
+	else
+	{
+		fprintf(fout, "%08x", (U4)(address));
+	}
+	
+	fprintf(fout, ":  %s\n", disasm_line);
+}
+
+int disassemble_buffer(U1 *fd, long fs, U1 dsz, U8 origin, FILE *fout)
+{
+	U8 offsets[CRUDBIN_BATCH_SIZE];
+	U1 lengths[CRUDBIN_BATCH_SIZE];
+	U4 encodings[CRUDBIN_BATCH_SIZE];
+	struct ix_icode_t icodes[CRUDBIN_BATCH_SIZE];
+	const char *status[CRUDBIN_BATCH_SIZE];
+	struct ix_decode_batch_t batch;
+	size_t i;
+	U8 start_origin = origin;
+	
+	batch.offsets = offsets;
+	batch.lengths = lengths;
+	batch.encodings = encodings;
+	batch.icodes = icodes;
+	batch.status = status;
+	
+	write_header(dsz, origin, fout);
 	
 	while(fs > 0)
 	{
-		status = crudasm_intel_decode(&icode, fs, dsz, fd + (size_t)(origin - start_origin), &state);
-		if(*status != '\0')
+		crudasm_intel_decode_batch(fd + (size_t)(origin - start_origin), fs, dsz, &batch, CRUDBIN_BATCH_SIZE);
+		
+		for(i = 0; i < batch.count; ++i)
 		{
-			// Error decoding.
-			//fprintf(fout, "db 0x%02x\n", (U4)(U1)(fd[origin]));
-			fprintf(fout, "db 0x%02x\t; %s\n", (U4)(U1)(fd[origin - start_origin]), status);
-			++origin;
-			--fs;
-		}
-		else
-		{
-			insn_size = state.insn_size;
-			
-			crudasm_intel_disasm(&icode, origin + insn_size, disasm_line, NULL, NULL, dsz);
-			
-			fprintf(fout, "loc_");
-			if(dsz == 2)
-			{
-				fprintf(fout, "%08x%08x", (U4)((origin >> 16) >> 16), (U4)(origin));
-			}
-			else
-			{
-				fprintf(fout, "%08x", (U4)(origin));
-			}
-			
-			fprintf(fout, ":  %s\n", disasm_line);
-			
-			origin += insn_size;
-			if(fs < insn_size)
-				fs = 0;
-			fs -= insn_size;
+			write_insn(&icodes[i], origin + offsets[i], lengths[i], fd[origin - start_origin + offsets[i]], status[i], dsz, fout);
 		}
+		
+		origin += batch.next_offset;
+		fs -= (long)(batch.next_offset);
 	}
 	
 	return 0;
 }
 
+struct stream_output_t
+{
+	U1 dsz;
+	FILE *fout;
+};
+
+static void stream_callback(void *context, U8 offset, const U1 *bytes, U1 size, struct ix_icode_t *icode, struct ix_decoder_state_t *state, int status)
+{
+	struct stream_output_t *output = (struct stream_output_t *)(context);
+	write_insn(icode, offset, size, bytes[0], crudasm_intel_status_message(status), output->dsz, output->fout);
+}
+
+// Disassembles a stream (e.g. stdin) a chunk at a time, so it can be any size.
+int disassemble_stream(FILE *fi, U1 dsz, U8 origin, FILE *fout)
+{
+	U1 chunk[CRUDBIN_CHUNK_SIZE];
+	size_t len;
+	struct crudasm_intel_stream_t stream;
+	struct stream_output_t output;
+	
+	output.dsz = dsz;
+	output.fout = fout;
+	crudasm_intel_stream_init(&stream, dsz, origin, stream_callback, &output);
+	
+	write_header(dsz, origin, fout);
+	
+	while((len = fread(chunk, 1, sizeof(chunk), fi)) != 0)
+		crudasm_intel_stream_feed(&stream, chunk, len);
+	crudasm_intel_stream_finish(&stream);
+	
+	return ferror(fi) ? 1 : 0;
+}
+
 int disassemble_file(const char *filename, U1 dsz, U8 origin, FILE *fout)
 {
 	FILE *fi;
@@ -114,6 +172,7 @@ void usage()
 	printf("Copyright (C) 2011,2012 Willow Schlanger. All rights reserved.\n\n");
 	printf("usage: crudbin filename bits origin\n");
 	printf("example: crudbin myprogram.com 16 0x100\n");
+	printf("use - as the filename to read from stdin.\n");
 }
 
 int main(int argc, const char **argv)
@@ -162,6 +221,11 @@ int main(int argc, const char **argv)
 	}
 	
 	filename = argv[1];
+	if(strcmp(filename, "-") == 0)
+	{
+		fprintf(stdout, "; disassembly of stdin\n");
+		return disassemble_stream(stdin, dsz, origin, stdout);
+	}
 	return disassemble_file(filename, dsz, origin, stdout);
 }
 
@@ -29,6 +29,9 @@
 #ifdef _WIN32
 #include "winhelpers.h"
 #include <psapi.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
 #endif
 
 #include <vector>
@@ -58,6 +61,8 @@ namespace infrared
 	typedef signed char S1;
 }
 
+struct osal_thread_t;
+
 // Operating System Abstraction Layer helper class.
 class osal_t
 {
@@ -69,8 +74,105 @@ class osal_t
 public:
 	osal_t(int argc, char *argv[]);
 	std::string arg(size_t num) const;
+	size_t num_args() const  { return args.size(); }
+
+	// Returns the number of processors we can run threads on (at least 1).
+	static unsigned num_processors();
+
+	// Calls func(args[i]) for each i < count, each on its own thread, and waits for all of them to return.
+	static void run_threads(void (*func)(void *), void **args, size_t count);
+
+	// Starts func(arg) on a new thread. Returns NULL if that can't be done.
+	static osal_thread_t *start_thread(void (*func)(void *), void *arg);
+
+	// Waits for a thread from start_thread() to return, and frees it.
+	static void join_thread(osal_thread_t *thread);
+};
+
+// A mutex with a condition variable, for threads that wait on each other's progress.
+class osal_monitor_t
+{
+	osal_monitor_t(const osal_monitor_t &)  { }		// not allowed
+	osal_monitor_t &operator=(const osal_monitor_t &)  { return *this; }	// not allowed
+
+#ifdef _WIN32
+	CRITICAL_SECTION section;
+	CONDITION_VARIABLE cond;
+#else
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+#endif
+
+public:
+	osal_monitor_t();
+	~osal_monitor_t();
+
+	void lock();
+	void unlock();
+
+	// Waits until notify_all() is called. The caller must hold the lock; it's released meanwhile.
+	void wait();
+	void notify_all();
+};
+
+// ------------------------------------------------------------------------
+
+// Output text, assembled in place and then written out with a single write().
+// buf.size() is the capacity; the first 'size' bytes are in use.
+class output_block_t
+{
+public:
+	std::vector<char> buf;
+	size_t size;
+
+	output_block_t() : size(0)  { }
+
+	// Makes room for at least n (> 0) more bytes. Returns where they go.
+	char *reserve(size_t n);
+
+	void append(const char *text, size_t n)  { memcpy(reserve(n), text, n); size += n; }
+	void append(const char *text)  { append(text, strlen(text)); }
+	void append(const std::string &text)  { if(!text.empty()) append(text.data(), text.size()); }
+
+	// Appends value as 16 hex digits, the way write_U8() writes it.
+	void append_U8(infrared::U8 value);
+
+	// Appends value in decimal.
+	void append_dec(infrared::U8 value);
+
+	void flush(std::ostream &os)  { if(size != 0) os.write(&buf[0], size); size = 0; }
 };
 
+char *output_block_t::reserve(size_t n)
+{
+	if(buf.size() - size < n)
+		buf.resize((buf.size() * 2 > size + n) ? buf.size() * 2 : size + n + 4096);
+	return &buf[size];
+}
+
+void output_block_t::append_U8(infrared::U8 value)
+{
+	char *p = reserve(16);
+	for(int i = 15; i >= 0; --i)
+	{
+		p[i] = "0123456789abcdef"[value & 0xf];
+		value >>= 4;
+	}
+	size += 16;
+}
+
+void output_block_t::append_dec(infrared::U8 value)
+{
+	char s[20];
+	int i = 20;
+	do
+	{
+		s[--i] = (char)('0' + value % 10);
+		value /= 10;
+	}	while(value != 0);
+	append(s + i, 20 - i);
+}
+
 // ------------------------------------------------------------------------
 
 class extended_info_t
@@ -150,6 +252,9 @@ protected:
 	std::string main_hash_value;
 	std::string main_filename;
 
+	// Number of threads disassemble() sweeps with; 1 means a plain serial sweep.
+	unsigned sweep_threads;
+
 public:
 	virtual ~quick_disassembler_t();
 
@@ -161,12 +266,82 @@ public:
 	// Returns 0 on success, nonzero in case of error.	
 	virtual int disassemble(std::ostream &os);
 
+	void set_sweep_threads(unsigned num_threads)  { sweep_threads = (num_threads == 0) ? 1 : num_threads; }
+
 protected:
+	// Per-thread decoder state. The parallel sweep gives each of its threads one of these.
+	class context_t
+	{
+	public:
+		virtual ~context_t()  { }
+	};
+
+	// do_disassemble() appends the text of the instruction decode_insn() last decoded to out.
 	virtual int decode_insn(infrared::U8 offset) = 0;
-	virtual const char *do_disassemble(infrared::U8 offset) = 0;
+	virtual void do_disassemble(infrared::U8 offset, output_block_t &out) = 0;
+
+	virtual context_t *new_context() = 0;
+	virtual int decode_insn(context_t *context, infrared::U8 offset) = 0;
+	virtual void do_disassemble(context_t *context, infrared::U8 offset, output_block_t &out) = 0;
 
 private:
+	// Marks for the parallel sweep, one byte per image byte of a round: 0 if no loop iteration
+	// of the serial sweep starts here, else the instruction length or one of these.
+	enum
+	{
+		sweep_nonexec = 0x40,		// skipping non-executable bytes
+		sweep_invalid = 0x80		// skipping unrecognized or invalid opcode bytes
+	};
+
+	// One chunk, [begin, end), of the parallel sweep.
+	struct sweep_job_t
+	{
+		context_t *context;
+		infrared::U8 begin;
+		infrared::U8 end;
+		infrared::U1 *marks;		// marks[0] is for offset 'begin'
+		infrared::U4 *text_pos;		// where in text each marked iteration's output starts, past any label
+		infrared::U8 exit;			// first loop iteration at or past 'end'
+		bool exit_after_insn;		// true if the iteration leading to 'exit' disassembled an instruction
+		output_block_t text;		// output of the speculative walk
+		size_t text_start;			// the real stream's output is head, then text from here on
+		output_block_t head;
+	};
+
+	// What the threads of a parallel sweep share. Chunk c starts at first + c * chunk_size and goes in
+	// jobs[c % jobs.size()], once chunk c - jobs.size() has been written. walked[i] is one more than the
+	// number of the chunk last walked in jobs[i]. The monitor guards walked, written and num_workers.
+	struct sweep_pipeline_t
+	{
+		quick_disassembler_t *owner;
+		infrared::U8 first;
+		infrared::U8 chunk_size;
+		size_t num_chunks;
+		size_t num_workers;		// worker w walks chunks w, w + num_workers, ...
+		std::vector<sweep_job_t> jobs;
+		std::vector<size_t> walked;
+		size_t written;			// number of chunks written out
+		osal_monitor_t monitor;
+	};
+
+	struct sweep_worker_t
+	{
+		sweep_pipeline_t *pipeline;
+		size_t index;
+	};
+
 	void write_U8(std::ostream &os, infrared::U8 value);
+	void write_insn_label(output_block_t &out, infrared::U8 offset, bool after_insn);
+
+	void sweep_serial(std::ostream &os);
+	void sweep_parallel(std::ostream &os);
+	infrared::U8 sweep_next(context_t *context, infrared::U8 offset, infrared::U1 &mark);
+	void sweep_write(context_t *context, infrared::U8 offset, infrared::U8 next, infrared::U1 mark, output_block_t &out);
+	void sweep_stitch(sweep_job_t &job, infrared::U8 &entry, bool &entry_after_insn);
+
+	void sweep_walk(sweep_job_t &job);
+
+	static void sweep_worker_thread(void *arg);
 };
 
 // ------------------------------------------------------------------------
@@ -185,7 +360,8 @@ quick_disassembler_t::quick_disassembler_t(const char *main_fdT, long long main_
 	bin_fd(bin_fdT),
 	bin_fs(bin_fsT),
 	metadata(NULL),
-	metadata_size(0)
+	metadata_size(0),
+	sweep_threads(1)
 {
 	metadata_size = (raw_bits == 0) ? raw_fs : main_fs;
 	metadata = new char [metadata_size];
@@ -342,31 +518,70 @@ void quick_disassembler_t::write_U8(std::ostream &os, infrared::U8 value)
 	os << s;
 }
 
-// Returns 0 on success, nonzero in case of error.
-int quick_disassembler_t::disassemble(std::ostream &os)
+// Writes what goes before the text of one disassembled instruction. after_insn is true if it directly
+// follows the previous one. The caller then appends the text and a newline.
+void quick_disassembler_t::write_insn_label(output_block_t &out, infrared::U8 offset, bool after_insn)
 {
-	using namespace std;
-	const infrared::U8 size = metadata_size;
-	
-	os << "; Disassembled by CRUDASM9. Origin: 0x";
-	write_U8(os, origin);
-	os << ". Entrypoint: loc_";
-	write_U8(os, origin + entrypoint);
-	os << ".\n";
-	
-	if(!main_filename.empty())
-		os << "; Original filename: " << main_filename << "  (" << actual_bits << " bits)\n";
+	if(!after_insn || ((metadata[offset] & (1 << 4)) != 0))
+	{
+		out.append("\n", 1);
+
+		if((metadata[offset] & (1 << 4)) != 0)	// we have extended information here!
+		{
+			// Use find() rather than [] here: the parallel sweep calls us from several threads at once.
+			std::map<infrared::U8, extended_info_t>::const_iterator i = ext_metadata_map.find(offset);
+			
+			if(i != ext_metadata_map.end())
+			{
+				const extended_info_t &x = i->second;
+				
+				if(x.is_entrypoint)
+					out.append("; This is the entrypoint!\n");
+				
+				if(!x.export_name.empty())
+				{
+					out.append("; This is the location of the following export symbol: ");
+					out.append(x.export_name);
+					out.append("\n", 1);
+					
+					if(!x.export_name_undecorated.empty())
+					{
+						out.append("; Undecorated version of export symbol: ");
+						out.append(x.export_name_undecorated);
+						out.append("\n", 1);
+					}
+				}
+			}
+		}
+	}
 	
-	if(!main_hash_value.empty())
-		os << "; Original module SHA-256 hash value: " << main_hash_value << "\n";
+	out.append("loc_", 4);
+	out.append_U8(origin + offset);
+	out.append(":  ", 3);
+}
+
+// The serial sweep writes its output in blocks of about this many bytes.
+#ifndef CRUDASM9_OUTPUT_BLOCK_SIZE
+#define CRUDASM9_OUTPUT_BLOCK_SIZE (1 << 20)
+#endif
+
+void quick_disassembler_t::sweep_serial(std::ostream &os)
+{
+	const infrared::U8 size = metadata_size;
 	
 	infrared::U8 prev_offset = 0xffffffffffffffffULL;
+	output_block_t out;
 	
 	for(infrared::U8 offset = 0; offset < size; )
 	{
+		if(out.size >= CRUDASM9_OUTPUT_BLOCK_SIZE)
+			out.flush(os);
+		
 		if(offset < start_offset)
 		{
-			os << "\n[Skipped " << start_offset << " byte(s), to first section]\n";
+			out.append("\n[Skipped ");
+			out.append_dec(start_offset);
+			out.append(" byte(s), to first section]\n");
 			offset = start_offset;
 			continue;
 		}
@@ -381,7 +596,9 @@ int quick_disassembler_t::disassemble(std::ostream &os)
 				++offset;
 			}
 		
-			os << "\n[Skipped " << skipped << " non-executable byte(s)]\n";
+			out.append("\n[Skipped ");
+			out.append_dec(skipped);
+			out.append(" non-executable byte(s)]\n");
 			
 			continue;
 		}
@@ -405,45 +622,325 @@ int quick_disassembler_t::disassemble(std::ostream &os)
 				
 			}	while(insn_len == 0);
 			
-			os << "\n[Skipped " << skipped << " unrecognized or invalid opcode byte(s)]\n";
+			out.append("\n[Skipped ");
+			out.append_dec(skipped);
+			out.append(" unrecognized or invalid opcode byte(s)]\n");
 			continue;
 		}
 		
 		// Now let's disassemble this code!
 		
-		const char *disasm_text = do_disassemble(offset);
+		write_insn_label(out, offset, prev_offset == offset);
+		do_disassemble(offset, out);
+		out.append("\n", 1);
 		
-		if(prev_offset != offset || ((metadata[offset] & (1 << 4)) != 0))
-		{
-			os << "\n";
+		offset += insn_len;
+		prev_offset = offset;
+	}
+	
+	out.flush(os);
+}
 
-			if((metadata[offset] & (1 << 4)) != 0)	// we have extended information here!
-			{
-				extended_info_t &x = ext_metadata_map[offset];
-				
-				if(x.is_entrypoint)
-					os << "; This is the entrypoint!\n";
-				
-				if(!x.export_name.empty())
-				{
-					os << "; This is the location of the following export symbol: " << x.export_name << "\n";
-					
-					if(!x.export_name_undecorated.empty())
-					{
-						os << "; Undecorated version of export symbol: " << x.export_name_undecorated << "\n";
-					}
-				}
-			}
-		}
+// ------------------------------------------------------------------------
+// Parallel sweep.
+//
+// The image is split into chunks, which worker threads take in turn. Each worker decodes and
+// formats its chunk speculatively, starting at the chunk's first byte, and marks where each
+// iteration of the serial loop in sweep_serial() would start and where its text went. The
+// calling thread stitches the chunks together in order, and writes each one out while the
+// workers go on with the next ones: the real stream enters a chunk at the previous chunk's exit offset,
+// and we decode serially from there until we reach an offset the speculative walk also visited.
+// From that point on both streams are the same, and x86 code usually gets there within a few
+// instructions, so all we redo is those few and the label where the streams meet. Every byte
+// is decoded once, apart from those. The output is the same as that of sweep_serial().
+
+// Each chunk of a parallel sweep round covers this many bytes.
+#ifndef CRUDASM9_SWEEP_CHUNK_SIZE
+#define CRUDASM9_SWEEP_CHUNK_SIZE (1 << 20)
+#endif
+
+// -jN accepts at most this many threads.
+#ifndef CRUDASM9_MAX_SWEEP_THREADS
+#define CRUDASM9_MAX_SWEEP_THREADS 256
+#endif
+
+// Does what one iteration of the loop in sweep_serial() does at 'offset', minus the output. Returns
+// where the next iteration starts. mark receives the instruction length, sweep_nonexec or sweep_invalid.
+infrared::U8 quick_disassembler_t::sweep_next(context_t *context, infrared::U8 offset, infrared::U1 &mark)
+{
+	const infrared::U8 size = metadata_size;
+	
+	if((metadata[offset] & (1 << 2)) == 0)
+	{
+		mark = sweep_nonexec;
 		
-		os << "loc_";
-		write_U8(os, origin + offset);
-		os << ":  " << disasm_text << "\n";
+		while(offset < size && (metadata[offset] & (1 << 2)) == 0)
+			++offset;
 		
-		offset += insn_len;
-		prev_offset = offset;
+		return offset;
+	}
+	
+	int insn_len = decode_insn(context, offset);
+	
+	if(insn_len != 0)
+	{
+		mark = (infrared::U1)(insn_len);
+		return offset + insn_len;
+	}
+	
+	mark = sweep_invalid;
+	
+	do
+	{
+		++offset;
+
+		if(offset >= size)
+			break;
+	
+		insn_len = decode_insn(context, offset);
+		
+	}	while(insn_len == 0);
+	
+	return offset;
+}
+
+// Writes the output of one loop iteration of sweep_serial(), as found by sweep_next(), minus the
+// instruction's label. For an instruction, context must still hold what sweep_next() decoded.
+void quick_disassembler_t::sweep_write(context_t *context, infrared::U8 offset, infrared::U8 next, infrared::U1 mark, output_block_t &out)
+{
+	if(mark == sweep_nonexec || mark == sweep_invalid)
+	{
+		out.append("\n[Skipped ");
+		out.append_dec(next - offset);
+		if(mark == sweep_nonexec)
+			out.append(" non-executable byte(s)]\n");
+		else
+			out.append(" unrecognized or invalid opcode byte(s)]\n");
+		return;
+	}
+	
+	do_disassemble(context, offset, out);
+	out.append("\n", 1);
+}
+
+void quick_disassembler_t::sweep_walk(sweep_job_t &job)
+{
+	infrared::U8 offset = job.begin;
+	infrared::U1 mark = 0;
+	bool after_insn = false;
+	
+	memset(job.marks, 0, (size_t)(job.end - job.begin));
+	job.text.size = 0;
+	
+	while(offset < job.end)
+	{
+		infrared::U8 next = sweep_next(job.context, offset, mark);
+		bool is_insn = (mark != sweep_nonexec && mark != sweep_invalid);
+		
+		// The label of the first iteration is rewritten when stitching, so after_insn is only a guess there.
+		if(is_insn)
+			write_insn_label(job.text, offset, after_insn);
+		job.marks[offset - job.begin] = mark;
+		job.text_pos[offset - job.begin] = (infrared::U4)(job.text.size);
+		sweep_write(job.context, offset, next, mark, job.text);
+		after_insn = is_insn;
+		offset = next;
+	}
+	
+	job.exit = offset;
+	job.exit_after_insn = after_insn;
+}
+
+// entry is where the real stream enters this chunk; on return, it's where it enters the next one.
+void quick_disassembler_t::sweep_stitch(sweep_job_t &job, infrared::U8 &entry, bool &entry_after_insn)
+{
+	infrared::U8 offset = entry;
+	bool after_insn = entry_after_insn;
+	
+	job.head.size = 0;
+	
+	while(offset < job.end && job.marks[offset - job.begin] == 0)
+	{
+		infrared::U1 mark = 0;
+		infrared::U8 next = sweep_next(job.context, offset, mark);
+		bool is_insn = (mark != sweep_nonexec && mark != sweep_invalid);
+		
+		if(is_insn)
+			write_insn_label(job.head, offset, after_insn);
+		sweep_write(job.context, offset, next, mark, job.head);
+		after_insn = is_insn;
+		offset = next;
+	}
+	
+	if(offset >= job.end)
+	{
+		// We never caught up, so none of the speculative walk is any good.
+		job.text_start = job.text.size;
+		job.exit = offset;
+		job.exit_after_insn = after_insn;
+	}
+	else
+	{
+		// The streams meet here. The walk may have got here another way, so redo the label.
+		infrared::U1 mark = job.marks[offset - job.begin];
+		
+		if(mark != sweep_nonexec && mark != sweep_invalid)
+			write_insn_label(job.head, offset, after_insn);
+		job.text_start = job.text_pos[offset - job.begin];
+	}
+	
+	entry = job.exit;
+	entry_after_insn = job.exit_after_insn;
+}
+
+void quick_disassembler_t::sweep_worker_thread(void *arg)
+{
+	sweep_worker_t &worker = *(sweep_worker_t *)(arg);
+	sweep_pipeline_t &pipeline = *worker.pipeline;
+	const size_t num_jobs = pipeline.jobs.size();
+	const infrared::U8 size = pipeline.owner->metadata_size;
+	size_t step;
+	
+	pipeline.monitor.lock();
+	step = pipeline.num_workers;
+	pipeline.monitor.unlock();
+	
+	for(size_t c = worker.index; c < pipeline.num_chunks; c += step)
+	{
+		sweep_job_t &job = pipeline.jobs[c % num_jobs];
+		
+		pipeline.monitor.lock();
+		while(pipeline.written + num_jobs <= c)
+			pipeline.monitor.wait();
+		pipeline.monitor.unlock();
+		
+		job.begin = pipeline.first + pipeline.chunk_size * c;
+		job.end = job.begin + pipeline.chunk_size;
+		
+		if(job.end > size)
+			job.end = size;
+		
+		pipeline.owner->sweep_walk(job);
+		
+		pipeline.monitor.lock();
+		pipeline.walked[c % num_jobs] = c + 1;
+		pipeline.monitor.notify_all();
+		pipeline.monitor.unlock();
+	}
+}
+
+void quick_disassembler_t::sweep_parallel(std::ostream &os)
+{
+	const infrared::U8 size = metadata_size;
+	const infrared::U8 chunk_size = CRUDASM9_SWEEP_CHUNK_SIZE;
+	sweep_pipeline_t pipeline;
+	
+	pipeline.owner = this;
+	pipeline.first = (start_offset < size) ? start_offset : size;
+	pipeline.chunk_size = chunk_size;
+	pipeline.num_chunks = (size_t)((size - pipeline.first + chunk_size - 1) / chunk_size);
+	pipeline.written = 0;
+	
+	// No more workers than chunks, and two jobs per worker: one being walked while the other waits to be written.
+	size_t num_workers = (sweep_threads < pipeline.num_chunks) ? sweep_threads : pipeline.num_chunks;
+	std::vector<infrared::U1> marks((size_t)(chunk_size * 2 * num_workers));
+	std::vector<infrared::U4> text_pos((size_t)(chunk_size * 2 * num_workers));
+	std::vector<sweep_worker_t> workers(num_workers);
+	std::vector<osal_thread_t *> threads;
+	
+	pipeline.jobs.resize(2 * num_workers);
+	pipeline.walked.resize(2 * num_workers, 0);
+	
+	for(size_t i = 0; i < pipeline.jobs.size(); ++i)
+	{
+		pipeline.jobs[i].context = new_context();
+		pipeline.jobs[i].marks = &marks[(size_t)(chunk_size * i)];
+		pipeline.jobs[i].text_pos = &text_pos[(size_t)(chunk_size * i)];
+	}
+	
+	// The workers only learn how many of them there are once they've all been started.
+	pipeline.monitor.lock();
+	for(size_t i = 0; i < num_workers; ++i)
+	{
+		workers[threads.size()].pipeline = &pipeline;
+		workers[threads.size()].index = threads.size();
+		
+		osal_thread_t *thread = osal_t::start_thread(sweep_worker_thread, &workers[threads.size()]);
+		
+		if(thread != NULL)
+			threads.push_back(thread);
+	}
+	pipeline.num_workers = threads.size();
+	pipeline.monitor.unlock();
+	
+	if(threads.empty())
+	{
+		for(size_t i = 0; i < pipeline.jobs.size(); ++i)
+			delete pipeline.jobs[i].context;
+		
+		sweep_serial(os);
+		return;
+	}
+	
+	infrared::U8 offset = pipeline.first;
+	bool after_insn = false;
+	
+	if(start_offset > 0)
+		os << "\n[Skipped " << start_offset << " byte(s), to first section]\n";
+	
+	for(size_t c = 0; c < pipeline.num_chunks; ++c)
+	{
+		sweep_job_t &job = pipeline.jobs[c % pipeline.jobs.size()];
+		
+		pipeline.monitor.lock();
+		while(pipeline.walked[c % pipeline.jobs.size()] != c + 1)
+			pipeline.monitor.wait();
+		pipeline.monitor.unlock();
+		
+		sweep_stitch(job, offset, after_insn);
+		
+		job.head.flush(os);
+		if(job.text.size > job.text_start)
+			os.write(&job.text.buf[job.text_start], job.text.size - job.text_start);
+		job.text.size = 0;
+		
+		pipeline.monitor.lock();
+		pipeline.written = c + 1;
+		pipeline.monitor.notify_all();
+		pipeline.monitor.unlock();
 	}
 	
+	for(size_t i = 0; i < threads.size(); ++i)
+		osal_t::join_thread(threads[i]);
+	
+	for(size_t i = 0; i < pipeline.jobs.size(); ++i)
+		delete pipeline.jobs[i].context;
+}
+
+// ------------------------------------------------------------------------
+
+// Returns 0 on success, nonzero in case of error.
+int quick_disassembler_t::disassemble(std::ostream &os)
+{
+	using namespace std;
+	
+	os << "; Disassembled by CRUDASM9. Origin: 0x";
+	write_U8(os, origin);
+	os << ". Entrypoint: loc_";
+	write_U8(os, origin + entrypoint);
+	os << ".\n";
+	
+	if(!main_filename.empty())
+		os << "; Original filename: " << main_filename << "  (" << actual_bits << " bits)\n";
+	
+	if(!main_hash_value.empty())
+		os << "; Original module SHA-256 hash value: " << main_hash_value << "\n";
+	
+	if(sweep_threads > 1)
+		sweep_parallel(os);
+	else
+		sweep_serial(os);
+	
 	if(!import_set.empty())
 	{
 		os << "\n; There are " << import_set.size() << " imported symbol(s).\n";
@@ -708,6 +1205,11 @@ int quick_disassembler_t::init(std::ostream &os)
 			return 1;
 		}
 	}
+	else
+	{
+		// A raw binary image has no sections; treat all of it as present and executable.
+		memset(metadata, (1 << 0) | (1 << 2), metadata_size);
+	}
 
 	return 0;
 }
@@ -719,9 +1221,17 @@ int quick_disassembler_t::init(std::ostream &os)
 class crudasm9_quick_disassembler_t :
 	public quick_disassembler_t
 {
-	struct ix_icode_t icode;
-	struct ix_decoder_state_t state;
-	char disasm_line[4096];
+	class crudasm9_context_t :
+		public context_t
+	{
+	public:
+		struct ix_icode_t icode;
+		struct ix_decoder_state_t state;
+	};
+
+	static int grow_sink(struct crudasm_intel_disasm_sink_t *sink, size_t need);
+
+	crudasm9_context_t main_context;
 
 public:
 	virtual ~crudasm9_quick_disassembler_t();
@@ -733,7 +1243,13 @@ public:
 
 	virtual int decode_insn(infrared::U8 offset);
 
-	virtual const char *do_disassemble(infrared::U8 offset);
+	virtual void do_disassemble(infrared::U8 offset, output_block_t &out);
+
+	virtual context_t *new_context();
+
+	virtual int decode_insn(context_t *context, infrared::U8 offset);
+
+	virtual void do_disassemble(context_t *context, infrared::U8 offset, output_block_t &out);
 };
 
 // ------------------------------------------------------------------------
@@ -749,6 +1265,22 @@ crudasm9_quick_disassembler_t::crudasm9_quick_disassembler_t(const char *main_fd
 
 int crudasm9_quick_disassembler_t::decode_insn(infrared::U8 offset)
 {
+	return decode_insn(&main_context, offset);
+}
+
+void crudasm9_quick_disassembler_t::do_disassemble(infrared::U8 offset, output_block_t &out)
+{
+	do_disassemble(&main_context, offset, out);
+}
+
+quick_disassembler_t::context_t *crudasm9_quick_disassembler_t::new_context()
+{
+	return new crudasm9_context_t;
+}
+
+int crudasm9_quick_disassembler_t::decode_insn(context_t *context, infrared::U8 offset)
+{
+	crudasm9_context_t &ctx = *static_cast<crudasm9_context_t *>(context);
 	U1 dsz = 0;
 	
 	if(actual_bits == 16)
@@ -766,16 +1298,31 @@ int crudasm9_quick_disassembler_t::decode_insn(infrared::U8 offset)
 	if(raw_bits == 0)
 		fd = (const U1 *)(raw_fd);
 
-	const char *status = crudasm_intel_decode(&icode, metadata_size - offset, dsz, (U1 *)(fd) + (size_t)(offset), &state);
+	const char *status = crudasm_intel_decode(&ctx.icode, metadata_size - offset, dsz, (U1 *)(fd) + (size_t)(offset), &ctx.state);
 	
 	if(*status != '\0')
 		return 0;	// something went wrong	
 
-	return state.insn_size;
+	return ctx.state.insn_size;
+}
+
+// Lets crudasm_intel_disasm_sink() write straight into an output_block_t (sink->user).
+int crudasm9_quick_disassembler_t::grow_sink(struct crudasm_intel_disasm_sink_t *sink, size_t need)
+{
+	output_block_t &out = *(output_block_t *)(sink->user);
+	
+	out.size = sink->pos;
+	out.reserve(need);
+	sink->buf = &out.buf[0];
+	sink->size = out.buf.size();
+	
+	return 1;
 }
 
-const char *crudasm9_quick_disassembler_t::do_disassemble(infrared::U8 offset)
+void crudasm9_quick_disassembler_t::do_disassemble(context_t *context, infrared::U8 offset, output_block_t &out)
 {
+	crudasm9_context_t &ctx = *static_cast<crudasm9_context_t *>(context);
+	struct crudasm_intel_disasm_sink_t sink;
 	U1 dsz = 0;
 	
 	if(actual_bits == 16)
@@ -787,16 +1334,25 @@ const char *crudasm9_quick_disassembler_t::do_disassemble(infrared::U8 offset)
 	if(actual_bits == 64)
 		dsz = 2;
 	else
-		return "<unable to disassemble>";
+	{
+		out.append("<unable to disassemble>");
+		return;
+	}
 
-	disasm_line[0] = '\0';
+	out.reserve(64);
+	sink.buf = &out.buf[0];
+	sink.pos = out.size;
+	sink.size = out.buf.size();
+	sink.grow = grow_sink;
+	sink.user = &out;
+	sink.truncated = 0;
 
-	crudasm_intel_disasm(&icode, origin + offset + (infrared::U8)(state.insn_size), disasm_line, NULL, NULL, dsz);
+	int len = crudasm_intel_disasm_sink(&sink, &ctx.icode, origin + offset + (infrared::U8)(ctx.state.insn_size), NULL, NULL, dsz);
 	
-	if(disasm_line[0] != '\0')
-		return disasm_line;
-
-	return "<unable to disassemble>";
+	out.size = sink.pos;
+	
+	if(len <= 0)
+		out.append("<unable to disassemble>");
 }
 
 int crudasm9_quick_disassembler_t::init(std::ostream &os)
@@ -811,6 +1367,115 @@ int crudasm9_quick_disassembler_t::init(std::ostream &os)
 
 // ------------------------------------------------------------------------
 
+struct osal_thread_t
+{
+	void (*func)(void *);
+	void *arg;
+#ifdef _WIN32
+	HANDLE handle;
+#else
+	pthread_t handle;
+#endif
+};
+
+#ifdef _WIN32
+static DWORD WINAPI osal_thread_proc(LPVOID param)
+{
+	osal_thread_t *t = (osal_thread_t *)(param);
+	t->func(t->arg);
+	return 0;
+}
+#else
+static void *osal_thread_proc(void *param)
+{
+	osal_thread_t *t = (osal_thread_t *)(param);
+	t->func(t->arg);
+	return NULL;
+}
+#endif
+
+unsigned osal_t::num_processors()
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	if(info.dwNumberOfProcessors > 0)
+		return info.dwNumberOfProcessors;
+#else
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	if(n > 0)
+		return (unsigned)(n);
+#endif
+	return 1;
+}
+
+void osal_t::run_threads(void (*func)(void *), void **args, size_t count)
+{
+	std::vector<osal_thread_t *> threads(count, (osal_thread_t *)(NULL));
+
+	// args[0] gets the calling thread. If we can't start a thread, we do its work here too.
+	for(size_t i = 1; i < count; ++i)
+	{
+		threads[i] = start_thread(func, args[i]);
+		if(threads[i] == NULL)
+			func(args[i]);
+	}
+	
+	if(count != 0)
+		func(args[0]);
+	
+	for(size_t i = 1; i < count; ++i)
+	{
+		if(threads[i] != NULL)
+			join_thread(threads[i]);
+	}
+}
+
+osal_thread_t *osal_t::start_thread(void (*func)(void *), void *arg)
+{
+	osal_thread_t *thread = new osal_thread_t;
+	
+	thread->func = func;
+	thread->arg = arg;
+#ifdef _WIN32
+	thread->handle = CreateThread(NULL, 0, osal_thread_proc, thread, 0, NULL);
+	if(thread->handle != NULL)
+		return thread;
+#else
+	if(pthread_create(&thread->handle, NULL, osal_thread_proc, thread) == 0)
+		return thread;
+#endif
+	delete thread;
+	return NULL;
+}
+
+void osal_t::join_thread(osal_thread_t *thread)
+{
+#ifdef _WIN32
+	WaitForSingleObject(thread->handle, INFINITE);
+	CloseHandle(thread->handle);
+#else
+	pthread_join(thread->handle, NULL);
+#endif
+	delete thread;
+}
+
+#ifdef _WIN32
+osal_monitor_t::osal_monitor_t()  { InitializeCriticalSection(&section); InitializeConditionVariable(&cond); }
+osal_monitor_t::~osal_monitor_t()  { DeleteCriticalSection(&section); }
+void osal_monitor_t::lock()  { EnterCriticalSection(&section); }
+void osal_monitor_t::unlock()  { LeaveCriticalSection(&section); }
+void osal_monitor_t::wait()  { SleepConditionVariableCS(&cond, &section, INFINITE); }
+void osal_monitor_t::notify_all()  { WakeAllConditionVariable(&cond); }
+#else
+osal_monitor_t::osal_monitor_t()  { pthread_mutex_init(&mutex, NULL); pthread_cond_init(&cond, NULL); }
+osal_monitor_t::~osal_monitor_t()  { pthread_cond_destroy(&cond); pthread_mutex_destroy(&mutex); }
+void osal_monitor_t::lock()  { pthread_mutex_lock(&mutex); }
+void osal_monitor_t::unlock()  { pthread_mutex_unlock(&mutex); }
+void osal_monitor_t::wait()  { pthread_cond_wait(&cond, &mutex); }
+void osal_monitor_t::notify_all()  { pthread_cond_broadcast(&cond); }
+#endif
+
 std::string osal_t::arg(size_t num) const
 {
 	if(num >= args.size())
@@ -866,6 +1531,203 @@ osal_t::osal_t(int argc, char *argv[])
 	}
 }
 
+// ------------------------------------------------------------------------
+// Guessing the number of bits of a raw binary file. We sweep the same sample
+// windows of the file in 16, 32, and 64-bit mode, one thread per mode, and
+// score what each mode finds there. Invalid opcodes, opcodes that are
+// invalid in 64-bit mode, and one-byte inc/dec (REX prefixes when the code is
+// really 64-bit) count against a mode. Calls that land inside the file,
+// common function prologues, and REX prefixes count for it.
+
+// We sample up to this many windows of this many bytes each.
+#define CRUDASM9_DETECT_WINDOWS 64
+#define CRUDASM9_DETECT_WINDOW_SIZE 4096
+
+class bits_detector_t
+{
+public:
+	const U1 *fd;
+	infrared::U8 fs;
+	U1 dsz;
+
+	infrared::U8 decoded;		// bytes covered by decoded instructions
+	infrared::U8 invalid;		// undecodable bytes
+	infrared::U8 no64;			// opcodes that are invalid in 64-bit mode
+	infrared::U8 calls_in;		// E8 calls that land inside the file
+	infrared::U8 calls_out;		// E8 calls that don't
+	infrared::U8 prologues;
+	infrared::U8 rex;			// instructions with a REX prefix
+	infrared::U8 incdec;		// one-byte inc/dec (40-4F), which are REX prefixes in 64-bit code
+
+	// Weighted evidence per 1000 decoded bytes. A mode that decodes fewer
+	// bytes doesn't win just by having less to count, and the data in a whole
+	// executable doesn't swamp the code.
+	long long score() const
+	{
+		long long sum = 10 * (long long)(calls_in + 5 * prologues) + 4 * (long long)(rex) -
+			10 * (long long)(calls_out + 2 * invalid + 2 * no64) - 4 * (long long)(incdec);
+		if(decoded == 0)
+			return sum;
+		return sum * 1000 / (long long)(decoded);
+	}
+
+	static void run(void *arg);
+
+private:
+	void sweep(infrared::U8 begin, infrared::U8 end);
+	bool is_prologue(infrared::U8 offset) const;
+};
+
+void bits_detector_t::run(void *arg)
+{
+	bits_detector_t &d = *(bits_detector_t *)(arg);
+	const infrared::U8 window = CRUDASM9_DETECT_WINDOW_SIZE;
+	
+	d.decoded = d.invalid = d.no64 = d.calls_in = d.calls_out = d.prologues = d.rex = d.incdec = 0;
+	
+	if(d.fs <= window * CRUDASM9_DETECT_WINDOWS)
+	{
+		d.sweep(0, d.fs);
+		return;
+	}
+	
+	for(infrared::U8 i = 0; i < CRUDASM9_DETECT_WINDOWS; ++i)
+	{
+		infrared::U8 begin = (d.fs - window) / (CRUDASM9_DETECT_WINDOWS - 1) * i;
+		d.sweep(begin, begin + window);
+	}
+}
+
+void bits_detector_t::sweep(infrared::U8 begin, infrared::U8 end)
+{
+	struct ix_icode_t icode;
+	struct ix_decoder_state_t state;
+	
+	for(infrared::U8 offset = begin; offset < end; )
+	{
+		int status = crudasm_intel_decode_status(&icode, fs - offset, dsz, (U1 *)(fd) + (size_t)(offset), &state);
+		
+		if(status != crudasm_intel_status_ok)
+		{
+			if(status == crudasm_intel_status_invalid_in_64bit)
+				++no64;
+			else
+				++invalid;
+			++offset;
+			continue;
+		}
+		
+		if(state.opcode0 == 0xe8 && state.imm1_offset < state.insn_size)
+		{
+			// Relative call: is the target inside the file?
+			infrared::S8 rel = 0;
+			U1 rel_size = state.insn_size - state.imm1_offset;
+			
+			for(U1 i = rel_size; i > 0; --i)
+				rel = (rel << 8) | fd[(size_t)(offset) + state.imm1_offset + i - 1];
+			rel = (rel << (64 - 8 * rel_size)) >> (64 - 8 * rel_size);	// sign-extend
+			
+			infrared::S8 target = (infrared::S8)(offset + state.insn_size) + rel;
+			
+			if(target >= 0 && target < (infrared::S8)(fs))
+				++calls_in;
+			else
+				++calls_out;
+		}
+		
+		if(state.rex_used)
+			++rex;
+		
+		if(state.opcode0 >= 0x40 && state.opcode0 <= 0x4f)
+			++incdec;
+		
+		if(is_prologue(offset))
+			++prologues;
+		
+		decoded += state.insn_size;
+		offset += state.insn_size;
+	}
+}
+
+bool bits_detector_t::is_prologue(infrared::U8 offset) const
+{
+	static const U1 prologues_16[][6] =
+	{
+		{5, 0x66, 0x55, 0x66, 0x89, 0xe5},	// push ebp; mov ebp, esp
+		{0}
+	};
+	static const U1 prologues_32[][4] =
+	{
+		{3, 0x55, 0x89, 0xe5},		// push ebp; mov ebp, esp (or bp, sp)
+		{3, 0x55, 0x8b, 0xec},		// push ebp; mov ebp, esp (or bp, sp)
+		{0}
+	};
+	static const U1 prologues_64[][5] =
+	{
+		{4, 0x55, 0x48, 0x89, 0xe5},	// push rbp; mov rbp, rsp
+		{4, 0x55, 0x48, 0x8b, 0xec},	// push rbp; mov rbp, rsp
+		{3, 0x48, 0x83, 0xec},			// sub rsp, imm8
+		{3, 0x48, 0x81, 0xec},			// sub rsp, imm32
+		{2, 0x41, 0x57},				// push r15
+		{2, 0x41, 0x56},				// push r14
+		{2, 0x41, 0x55},				// push r13
+		{2, 0x41, 0x54},				// push r12
+		{0}
+	};
+	
+	if(dsz == 0)
+	{
+		for(size_t i = 0; prologues_16[i][0] != 0; ++i)
+		{
+			if(offset + prologues_16[i][0] <= fs && memcmp(fd + (size_t)(offset), &prologues_16[i][1], prologues_16[i][0]) == 0)
+				return true;
+		}
+	}
+	
+	if(dsz != 2)
+	{
+		for(size_t i = 0; prologues_32[i][0] != 0; ++i)
+		{
+			if(offset + prologues_32[i][0] <= fs && memcmp(fd + (size_t)(offset), &prologues_32[i][1], prologues_32[i][0]) == 0)
+				return true;
+		}
+		return false;
+	}
+	
+	for(size_t i = 0; prologues_64[i][0] != 0; ++i)
+	{
+		if(offset + prologues_64[i][0] <= fs && memcmp(fd + (size_t)(offset), &prologues_64[i][1], prologues_64[i][0]) == 0)
+			return true;
+	}
+	return false;
+}
+
+// Returns 16, 32, or 64.
+static int guess_raw_bits(const char *fd, long long fs)
+{
+	bits_detector_t modes[3];
+	void *args[3];
+	int best = 1;
+	
+	for(int i = 0; i < 3; ++i)
+	{
+		modes[i].fd = (const U1 *)(fd);
+		modes[i].fs = fs;
+		modes[i].dsz = (U1)(i);
+		args[i] = &modes[i];
+	}
+	
+	osal_t::run_threads(bits_detector_t::run, args, 3);
+	
+	// On a tie, we prefer 32 bits, then 64 bits.
+	if(modes[2].score() > modes[best].score())
+		best = 2;
+	if(modes[0].score() > modes[best].score())
+		best = 0;
+	
+	return 16 << best;
+}
+
 // ------------------------------------------------------------------------
 
 int main(int argc, char *argv[])
@@ -878,13 +1740,51 @@ int main(int argc, char *argv[])
 
 	osal_t osal(argc, argv);
 	
-	std::string infile = osal.arg(1);
-	std::string outfile = osal.arg(2);
-	std::string bits = osal.arg(3);		// optional (may be "")
-	int n_bits = 0;				// 0 means unspecified; else it will be 16, 32, or 64
+	std::vector<std::string> params;	// arguments other than options
+	unsigned n_threads = 1;			// -jN: sweep with N threads (-j alone: one per processor)
 	
 	bool need_about = false;
 	
+	for(size_t i = 1; i < osal.num_args(); ++i)
+	{
+		std::string a = osal.arg(i);
+		
+		if(a.size() >= 2 && a[0] == '-' && a[1] == 'j')
+		{
+			if(a.size() == 2)
+			{
+				n_threads = osal_t::num_processors();
+				
+				if(n_threads > CRUDASM9_MAX_SWEEP_THREADS)
+					n_threads = CRUDASM9_MAX_SWEEP_THREADS;
+			}
+			else
+			{
+				using namespace std;
+				bool valid = a.find_first_not_of("0123456789", 2) == std::string::npos && a.size() <= 6;
+				
+				n_threads = valid ? (unsigned)(atoi(a.c_str() + 2)) : 0;
+				
+				if(n_threads == 0 || n_threads > CRUDASM9_MAX_SWEEP_THREADS)
+				{
+					std::cout << app_name << ": thread count must be 1 to " << CRUDASM9_MAX_SWEEP_THREADS << " (got \"" << a << "\")" << std::endl;
+					need_about = true;
+				}
+			}
+			
+			continue;
+		}
+		
+		params.push_back(a);
+	}
+	
+	params.resize(3);
+	
+	std::string infile = params[0];
+	std::string outfile = params[1];
+	std::string bits = params[2];		// optional (may be "")
+	int n_bits = 0;				// 0 means unspecified; else it will be 16, 32, or 64
+	
 	if(bits != "")
 	{
 		if(bits == "16")
@@ -911,8 +1811,10 @@ int main(int argc, char *argv[])
 	{
 		std::cout << "See license_crudasm9.txt or contact willow@willowschlanger.info for details." << std::endl;
 		std::cout << "\nVersion: 1.00.00002(beta)" << std::endl;
-		std::cout << "\nUsage: " << app_name << " infile outfile [bits]" << std::endl;
+		std::cout << "\nUsage: " << app_name << " infile outfile [bits] [-jN]" << std::endl;
+		std::cout << "\n  -jN  disassemble using N threads (-j: one thread per processor)" << std::endl;
 		std::cout << "\nExamples:\n  " << app_name << " dosprog.com dosprog.asm 16   (dosprog.com is a 16-bit binary)" << std::endl;
+		std::cout << "  " << app_name << " dump.bin dump.asm  (raw binary: bits are guessed from its contents)" << std::endl;
 		std::cout << "  " << app_name << " myfile.dat myfile.asm  (myfile.dat is the output from coffload)" << std::endl;
 
 #ifdef _WIN32
@@ -1007,17 +1909,11 @@ int main(int argc, char *argv[])
 	{
 		if(n_bits == 0)
 		{
-			std::cout << "Usage: " << app_name << " infile outfile [bits]" << std::endl;
-			std::cout << "\n" << app_name << ": 'bits' must be specified on the command-line for raw binary files!" << std::endl;
-
-			delete [] bin_fd;
-			delete [] raw_fd;	
-			delete [] main_fd;
-
-			return 1;
+			n_bits = guess_raw_bits(main_fd, main_fs);
+			std::cout << app_name << ": detected a raw " << n_bits << "-bit binary file (guessed; give 'bits' to override)" << std::endl;
 		}
-	
-		std::cout << app_name << ": detected a raw " << n_bits << "-bit binary file" << std::endl;
+		else
+			std::cout << app_name << ": detected a raw " << n_bits << "-bit binary file" << std::endl;
 		std::cout << "read " << get_filename_only(infile) << std::endl;
 	}
 	
@@ -1296,6 +2192,8 @@ int main(int argc, char *argv[])
 	
 	crudasm9_quick_disassembler_t crudasm_qdis(main_fd, main_fs, (is_dat) ? 0 : n_bits, raw_fd, raw_fs, bin_fd, bin_fs);
 	
+	crudasm_qdis.set_sweep_threads(n_threads);
+	
 	int result = crudasm_qdis.init(std::cout);
 	
 	if(result != 0)
@@ -0,0 +1,450 @@
+// bench1.cpp
+// g++ -O2 -o bench1 bench1.cpp ../../x86core/decoder_internal.c ../../x86core/ixdecoder.c ../../x86core/ixdisasm.c
+//
+// Decoder throughput benchmarks. Uses the test16/32/64.bin files (run test1
+// first to create them), or any files given on the command line (decoded in
+// 64 bit mode), each swept linearly many times. The decode cache is also
+// measured on a large synthetic 64 bit image, made of functions with the
+// usual prologues, epilogues, import stubs and padding around instructions
+// taken from the inputs. The cost of formatting instructions as text is
+// compared with the cost of decoding them, and formatting one instruction
+// per call with formatting a whole input per call. Finally the table accesses made
+// while decoding are replayed through a simulated L1 cache, for the decoder's
+// hot encoding table and for the full encoding records it replaced.
+//
+// Build with -DCRUDASM_COMPILED_ARGS to time the generated argument decoders
+// (out_intel_decode_funcs.h) instead of get_arguments().
+
+#include "../../x86core/ixdisasm.h"
+#include <stddef.h>
+#include <cstdlib>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <set>
+#include <vector>
+
+struct bench_input_t
+{
+	std::vector<U1> data;
+	U1 dsz;
+};
+
+static std::vector<bench_input_t> g_inputs;
+static size_t g_passes = 2000;
+
+static bool load_file(const char *fname, U1 dsz)
+{
+	FILE *fi = fopen(fname, "rb");
+	if(fi == NULL)
+		return false;
+	bench_input_t input;
+	input.dsz = dsz;
+	int c;
+	while((c = fgetc(fi)) != EOF)
+		input.data.push_back((U1)(c));
+	fclose(fi);
+	if(input.data.empty())
+		return false;
+	g_inputs.push_back(input);
+	return true;
+}
+
+// Prints one result line. Returns seconds elapsed.
+static double report(const char *name, clock_t start, U8 insns, U8 checksum)
+{
+	double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+	if(secs <= 0.0)
+		secs = 1e-9;
+	printf("%-28s %8.3f s  %10.2f M insns/s  (checksum %llu)\n", name, secs, (double)(insns) / secs / 1e6, checksum);
+	return secs;
+}
+
+static double bench_decode()
+{
+	U8 insns = 0, checksum = 0;
+	clock_t start = clock();
+	for(size_t pass = 0; pass < g_passes; ++pass)
+	{
+		for(size_t f = 0; f < g_inputs.size(); ++f)
+		{
+			std::vector<U1> &data = g_inputs[f].data;
+			for(size_t pos = 0; pos < data.size(); )
+			{
+				ix_icode_t icode;
+				ix_decoder_state_t state;
+				const char *s = crudasm_intel_decode(&icode, data.size() - pos, g_inputs[f].dsz, &data[pos], &state);
+				size_t size = (*s != '\0') ? 1 : state.insn_size;
+				checksum += size;
+				pos += size;
+				++insns;
+			}
+		}
+	}
+	return report("crudasm_intel_decode", start, insns, checksum);
+}
+
+static double bench_length()
+{
+	U8 insns = 0, checksum = 0;
+	clock_t start = clock();
+	for(size_t pass = 0; pass < g_passes; ++pass)
+	{
+		for(size_t f = 0; f < g_inputs.size(); ++f)
+		{
+			std::vector<U1> &data = g_inputs[f].data;
+			for(size_t pos = 0; pos < data.size(); )
+			{
+				size_t size = crudasm_intel_insn_length(data.size() - pos, g_inputs[f].dsz, &data[pos]);
+				if(size == 0)
+					size = 1;
+				checksum += size;
+				pos += size;
+				++insns;
+			}
+		}
+	}
+	return report("crudasm_intel_insn_length", start, insns, checksum);
+}
+
+static double bench_cached(const char *name, std::vector<bench_input_t> &inputs, size_t passes)
+{
+	U8 insns = 0, checksum = 0;
+	crudasm_intel_decode_cache_t *cache = new crudasm_intel_decode_cache_t;
+	crudasm_intel_decode_cache_init(cache);
+	clock_t start = clock();
+	for(size_t pass = 0; pass < passes; ++pass)
+	{
+		for(size_t f = 0; f < inputs.size(); ++f)
+		{
+			std::vector<U1> &data = inputs[f].data;
+			for(size_t pos = 0; pos < data.size(); )
+			{
+				ix_icode_t icode;
+				ix_decoder_state_t state;
+				int s = crudasm_intel_decode_cached(cache, &icode, data.size() - pos, inputs[f].dsz, &data[pos], &state);
+				size_t size = (s != crudasm_intel_status_ok) ? 1 : state.insn_size;
+				checksum += size;
+				pos += size;
+				++insns;
+			}
+		}
+	}
+	double secs = report(name, start, insns, checksum);
+	printf("  cache hit rate %.1f%% (%llu of %llu, %llu uncacheable)\n", 100.0 * (double)(cache->hits) / (double)(cache->lookups),
+		cache->hits, cache->lookups, cache->uncacheable);
+	delete cache;
+	return secs;
+}
+
+static double bench_decode_inputs(const char *name, std::vector<bench_input_t> &inputs, size_t passes)
+{
+	U8 insns = 0, checksum = 0;
+	clock_t start = clock();
+	for(size_t pass = 0; pass < passes; ++pass)
+	{
+		for(size_t f = 0; f < inputs.size(); ++f)
+		{
+			std::vector<U1> &data = inputs[f].data;
+			for(size_t pos = 0; pos < data.size(); )
+			{
+				ix_icode_t icode;
+				ix_decoder_state_t state;
+				int s = crudasm_intel_decode_status(&icode, data.size() - pos, inputs[f].dsz, &data[pos], &state);
+				size_t size = (s != crudasm_intel_status_ok) ? 1 : state.insn_size;
+				checksum += size;
+				pos += size;
+				++insns;
+			}
+		}
+	}
+	return report(name, start, insns, checksum);
+}
+
+// Times a sweep that only decodes against one that also formats each
+// instruction with crudasm_intel_disasm_n(), and prints how much the
+// formatting costs relative to the decoding.
+static void bench_disasm(size_t passes)
+{
+	char line[1024];
+	U8 insns = 0, checksum = 0;
+	double t_decode = bench_decode_inputs("decode only", g_inputs, passes);
+	clock_t start = clock();
+	for(size_t pass = 0; pass < passes; ++pass)
+	{
+		for(size_t f = 0; f < g_inputs.size(); ++f)
+		{
+			std::vector<U1> &data = g_inputs[f].data;
+			for(size_t pos = 0; pos < data.size(); )
+			{
+				ix_icode_t icode;
+				ix_decoder_state_t state;
+				int s = crudasm_intel_decode_status(&icode, data.size() - pos, g_inputs[f].dsz, &data[pos], &state);
+				size_t size = (s != crudasm_intel_status_ok) ? 1 : state.insn_size;
+				if(s == crudasm_intel_status_ok)
+					checksum += crudasm_intel_disasm_n(&icode, pos + size, line, sizeof(line), NULL, NULL, g_inputs[f].dsz);
+				pos += size;
+				++insns;
+			}
+		}
+	}
+	double t_disasm = report("decode + disasm", start, insns, checksum);
+	printf("format cost / decode cost: %.2f\n", (t_disasm - t_decode) / t_decode);
+}
+
+// Formats the inputs, decoded once up front, with one crudasm_intel_disasm_n()
+// call per instruction and then with one crudasm_intel_disasm_batch() call per
+// input into a single arena, and prints the ratio of the two times. Expect it
+// to be close to 1: the batch saves the per-call setup and the '\0's, which are
+// small next to the formatting itself. What it buys is the arena and the spans.
+static void bench_disasm_batch(size_t passes)
+{
+	std::vector<std::vector<ix_icode_t> > icodes(g_inputs.size());
+	std::vector<std::vector<U8> > rels(g_inputs.size());
+	std::vector<crudasm_intel_disasm_span_t> spans;
+	std::vector<char> arena;
+	char line[1024];
+	U8 insns = 0, checksum = 0;
+	for(size_t f = 0; f < g_inputs.size(); ++f)
+	{
+		std::vector<U1> &data = g_inputs[f].data;
+		for(size_t pos = 0; pos < data.size(); )
+		{
+			ix_icode_t icode;
+			ix_decoder_state_t state;
+			int s = crudasm_intel_decode_status(&icode, data.size() - pos, g_inputs[f].dsz, &data[pos], &state);
+			size_t size = (s != crudasm_intel_status_ok) ? 1 : state.insn_size;
+			if(s != crudasm_intel_status_ok)
+				icode.encoding = 0xffffffff;
+			pos += size;
+			icodes[f].push_back(icode);
+			rels[f].push_back(pos);
+		}
+		if(icodes[f].size() > spans.size())
+			spans.resize(icodes[f].size());
+		if(icodes[f].size() * 128 > arena.size())
+			arena.resize(icodes[f].size() * 128);
+	}
+
+	clock_t start = clock();
+	for(size_t pass = 0; pass < passes; ++pass)
+	{
+		for(size_t f = 0; f < g_inputs.size(); ++f)
+		{
+			for(size_t i = 0; i < icodes[f].size(); ++i)
+			{
+				if(icodes[f][i].encoding != 0xffffffff)
+					checksum += crudasm_intel_disasm_n(&icodes[f][i], rels[f][i], line, sizeof(line), NULL, NULL, g_inputs[f].dsz);
+				++insns;
+			}
+		}
+	}
+	double t_single = report("crudasm_intel_disasm_n", start, insns, checksum);
+
+	insns = 0;
+	checksum = 0;
+	start = clock();
+	for(size_t pass = 0; pass < passes; ++pass)
+	{
+		for(size_t f = 0; f < g_inputs.size(); ++f)
+		{
+			crudasm_intel_disasm_sink_t sink;
+			sink.buf = &arena[0];
+			sink.pos = 0;
+			sink.size = arena.size();
+			sink.grow = NULL;
+			sink.user = NULL;
+			sink.truncated = 0;
+			insns += crudasm_intel_disasm_batch(&sink, &icodes[f][0], &rels[f][0], icodes[f].size(), g_inputs[f].dsz, &spans[0]);
+			checksum += sink.pos;
+		}
+	}
+	double t_batch = report("crudasm_intel_disasm_batch", start, insns, checksum);
+	printf("disasm_n time / batch time: %.2f (the batch is for one arena with spans, not for speed)\n", t_single / t_batch);
+}
+
+// A 32 KB, 8 way, 64 byte line LRU cache. Only the accesses given to touch()
+// go through it, so it counts the misses a table would cause on its own.
+struct l1_sim_t
+{
+	enum { line_size = 64, num_sets = 64, num_ways = 8 };
+	size_t tags[num_sets][num_ways];	// most recently used first; 0 = empty
+	U8 accesses, misses;
+	std::set<size_t> lines;
+
+	l1_sim_t() : accesses(0), misses(0)
+	{
+		for(size_t i = 0; i < num_sets; ++i)
+			for(size_t j = 0; j < num_ways; ++j)
+				tags[i][j] = 0;
+	}
+
+	void touch(const void *p, size_t size)
+	{
+		size_t first = (size_t)(p) / line_size, last = ((size_t)(p) + size - 1) / line_size;
+		for(size_t line = first; line <= last; ++line)
+		{
+			size_t *set = tags[line % num_sets];
+			size_t j = 0;
+			++accesses;
+			lines.insert(line);
+			while(j < num_ways - 1 && set[j] != line + 1)
+				++j;
+			if(set[j] != line + 1)
+				++misses;
+			for(; j > 0; --j)
+				set[j] = set[j - 1];
+			set[0] = line + 1;
+		}
+	}
+};
+
+// Decodes the inputs once, then replays the decoder's per-encoding table
+// reads through l1_sim_t: one 16 byte record of crudasm_intel_encoding_hot_table[]
+// per instruction, versus the crudasm_intel_encoding_table[] record, the
+// instruction's crudasm_intel_insns[] record (for itags) and the
+// crudasm_intel_argsize_index[] entry.
+static void bench_table_lines(const char *name, std::vector<bench_input_t> &inputs)
+{
+	std::vector<U4> encodings;
+	for(size_t f = 0; f < inputs.size(); ++f)
+	{
+		std::vector<U1> &data = inputs[f].data;
+		for(size_t pos = 0; pos < data.size(); )
+		{
+			ix_icode_t icode;
+			ix_decoder_state_t state;
+			int s = crudasm_intel_decode_status(&icode, data.size() - pos, inputs[f].dsz, &data[pos], &state);
+			if(s != crudasm_intel_status_ok)
+			{
+				++pos;
+				continue;
+			}
+			encodings.push_back(icode.encoding);
+			pos += state.insn_size;
+		}
+	}
+
+	l1_sim_t hot, full;
+	for(size_t i = 0; i < encodings.size(); ++i)
+	{
+		U4 e = encodings[i];
+		hot.touch(crudasm_intel_encoding_hot_table + e, sizeof(crudasm_intel_encoding_hot_t));
+		full.touch(crudasm_intel_encoding_table + e, sizeof(crudasm_intel_encoding_t));
+		full.touch(&crudasm_intel_insns[crudasm_intel_encoding_table[e].insn].itags, sizeof(U4));
+		full.touch(crudasm_intel_argsize_index + e, sizeof(U2));
+	}
+	double n = (encodings.empty()) ? 1.0 : (double)(encodings.size());
+	printf("%s: %llu insns\n", name, (U8)(encodings.size()));
+	printf("  %-26s %6llu lines  %5.2f lines/insn  %8.3f misses/1000 insns\n", "hot table", (U8)(hot.lines.size()),
+		(double)(hot.accesses) / n, 1000.0 * (double)(hot.misses) / n);
+	printf("  %-26s %6llu lines  %5.2f lines/insn  %8.3f misses/1000 insns\n", "full records", (U8)(full.lines.size()),
+		(double)(full.accesses) / n, 1000.0 * (double)(full.misses) / n);
+}
+
+// Builds a synthetic 64 bit image of about size bytes. Function bodies use
+// instructions from the 64 bit inputs, favouring the first ones, so some
+// repeat a lot and most repeat rarely, as in real code.
+static void build_synthetic(bench_input_t &image, size_t size)
+{
+	static const U1 prologue[] = {0x55, 0x48, 0x89, 0xe5, 0x48, 0x83, 0xec, 0x20};
+	static const U1 epilogue[] = {0x48, 0x83, 0xc4, 0x20, 0x5d, 0xc3};
+	static const U1 nop6[] = {0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00};
+	std::vector<size_t> starts, sizes;
+	U4 seed = 12345;
+
+	for(size_t f = 0; f < g_inputs.size(); ++f)
+	{
+		if(g_inputs[f].dsz != 2)
+			continue;
+		std::vector<U1> &data = g_inputs[f].data;
+		for(size_t pos = 0; pos < data.size(); )
+		{
+			U1 len = crudasm_intel_insn_length(data.size() - pos, 2, &data[pos]);
+			if(len == 0)
+			{
+				++pos;
+				continue;
+			}
+			starts.push_back(f * 0x10000000 + pos);
+			sizes.push_back(len);
+			pos += len;
+		}
+	}
+
+	image.dsz = 2;
+	image.data.clear();
+	while(image.data.size() < size)
+	{
+		image.data.insert(image.data.end(), prologue, prologue + sizeof(prologue));
+		seed = seed * 1103515245 + 12345;
+		for(size_t n = 8 + (seed >> 16) % 40; n > 0 && !starts.empty(); --n)
+		{
+			seed = seed * 1103515245 + 12345;
+			size_t r = (seed >> 8) % starts.size();
+			size_t i = r * r / starts.size() * r / starts.size();	// mostly small indexes
+			U1 *insn = &g_inputs[starts[i] / 0x10000000].data[starts[i] % 0x10000000];
+			image.data.insert(image.data.end(), insn, insn + sizes[i]);
+			if(n % 7 == 0)
+			{
+				// call [rip+disp32], through a different import slot each time.
+				U1 stub[6] = {0xff, 0x15, (U1)(seed >> 3), (U1)(seed >> 11), 0, 0};
+				image.data.insert(image.data.end(), stub, stub + sizeof(stub));
+			}
+		}
+		image.data.insert(image.data.end(), epilogue, epilogue + sizeof(epilogue));
+		for(size_t n = (seed >> 24) % 3; n > 0; --n)
+			image.data.insert(image.data.end(), nop6, nop6 + sizeof(nop6));
+		image.data.push_back(0xcc);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	if(argc > 1)
+	{
+		for(int i = 1; i < argc; ++i)
+		{
+			if(!load_file(argv[i], 2))
+			{
+				std::cout << "error: unable to read " << argv[i] << std::endl;
+				return 1;
+			}
+		}
+		g_passes = 10;
+	}
+	else
+	{
+		const char *fnames[3] = {"test16.bin", "test32.bin", "test64.bin"};
+		for(int dsz = 0; dsz <= 2; ++dsz)
+		{
+			if(!load_file(fnames[dsz], dsz))
+			{
+				std::cout << "error: unable to read " << fnames[dsz] << " (run test1 first)" << std::endl;
+				return 1;
+			}
+		}
+	}
+
+	double t_decode = bench_decode();
+	double t_length = bench_length();
+	printf("length-only speedup: %.2fx\n", t_decode / t_length);
+
+	double t_plain = bench_decode_inputs("crudasm_intel_decode_status", g_inputs, g_passes);
+	double t_cached = bench_cached("crudasm_intel_decode_cached", g_inputs, g_passes);
+	printf("decode cache speedup: %.2fx\n", t_plain / t_cached);
+
+	bench_disasm(g_passes);
+	bench_disasm_batch(g_passes);
+
+	std::vector<bench_input_t> synthetic(1);
+	build_synthetic(synthetic[0], 64 << 20);
+	printf("synthetic image: %llu bytes\n", (U8)(synthetic[0].data.size()));
+	t_plain = bench_decode_inputs("crudasm_intel_decode_status", synthetic, 2);
+	t_cached = bench_cached("crudasm_intel_decode_cached", synthetic, 2);
+	printf("decode cache speedup: %.2fx\n", t_plain / t_cached);
+
+	bench_table_lines("encoding table lines, inputs", g_inputs);
+	bench_table_lines("encoding table lines, synthetic image", synthetic);
+	return 0;
+}
@@ -2,6 +2,9 @@
 if exist test1.exe del test1.exe
 g++ -o test1 test1.cpp ../../x86core/decoder_internal.c ../../x86core/ixdecoder.c ../../x86core/ixdisasm.c
 test1
+if exist test2.exe del test2.exe
+g++ -o test2 test2.cpp ../../x86core/decoder_internal.c ../../x86core/ixdecoder.c ../../x86core/ixdisasm.c
+test2
 ndisasm -b 16 test16.bin -o 0x100 >test16asm.txt
 ndisasm -b 32 test32.bin -o 0x100 >test32asm.txt
 ndisasm -b 64 test64.bin -o 0x100 >test64asm.txt
@@ -20,9 +20,9 @@ int main(int argc, char **argv)
 		const char *prev = NULL;
 		for(size_t enc_idx = 0; crudasm_intel_encoding_table[enc_idx].insn != crudasm_intel_insncount; ++enc_idx)
 		{
-			crudasm_intel_encoding_t &enc = crudasm_intel_encoding_table[enc_idx];
+			const crudasm_intel_encoding_t &enc = crudasm_intel_encoding_table[enc_idx];
 			U4 insn_num = enc.insn;
-			crudasm_intel_insn_t &insn = crudasm_intel_insns[insn_num];
+			const crudasm_intel_insn_t &insn = crudasm_intel_insns[insn_num];
 			const char *alias = insn.alias;
 			if(alias != prev)
 			{
@@ -0,0 +1,624 @@
+// test2.cpp
+// g++ -o test2 test2.cpp ../../x86core/decoder_internal.c ../../x86core/ixdecoder.c ../../x86core/ixdisasm.c
+//
+// Consistency checks for the alternate decoder entry points. Each check
+// compares an entry point against plain crudasm_intel_decode() over the
+// test16/32/64.bin files (run test1 first to create them), decoding at every
+// byte offset so that invalid and truncated encodings are covered too.
+
+#include "../../x86core/ixdisasm.h"
+#include <stddef.h>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+static int g_failures = 0;
+
+static void fail(const char *test, int dsz, size_t offset, const char *what)
+{
+	if(g_failures < 20)
+		std::cout << "FAIL: " << test << " (" << (16 << dsz) << "-bit) at offset " << offset << ": " << what << std::endl;
+	++g_failures;
+}
+
+static bool load_file(const char *fname, std::vector<U1> &data)
+{
+	FILE *fi = fopen(fname, "rb");
+	if(fi == NULL)
+		return false;
+	int c;
+	while((c = fgetc(fi)) != EOF)
+		data.push_back((U1)(c));
+	fclose(fi);
+	return !data.empty();
+}
+
+static bool same_icode(const ix_icode_t &a, const ix_icode_t &b, int dsz)
+{
+	if(a.encoding != b.encoding || a.has_disp != b.has_disp || a.has_imm != b.has_imm)
+		return false;
+	if(a.lockrep != b.lockrep || a.osz != b.osz || a.asz != b.asz || a.sx != b.sx)
+		return false;
+	if(a.rip_relative != b.rip_relative || a.imm64 != b.imm64 || a.fwait != b.fwait)
+		return false;
+	if(a.ea.base != b.ea.base || a.ea.index != b.ea.index || a.ea.sreg != b.ea.sreg)
+		return false;
+	for(int i = 0; i < 4; ++i)
+	{
+		if(a.argtype[i] != b.argtype[i])
+			return false;
+		if(a.argtype[i] == crudasm_intel_argtype_void)
+			break;
+		if(a.argsize[i] != b.argsize[i] || a.argvalue[i] != b.argvalue[i])
+			return false;
+	}
+	char line_a[1024], line_b[1024];
+	crudasm_intel_disasm_n(const_cast<ix_icode_t *>(&a), 0, line_a, sizeof(line_a), NULL, NULL, dsz);
+	crudasm_intel_disasm_n(const_cast<ix_icode_t *>(&b), 0, line_b, sizeof(line_b), NULL, NULL, dsz);
+	return strcmp(line_a, line_b) == 0;
+}
+
+// crudasm_intel_decode_batch() must agree with a linear sweep done one
+// instruction at a time.
+static void test_batch(std::vector<U1> &data, int dsz)
+{
+	const size_t max_insns = 100;	// deliberately small, to exercise restarting
+	U8 offsets[max_insns];
+	U1 lengths[max_insns];
+	U4 encodings[max_insns];
+	ix_icode_t icodes[max_insns];
+	const char *status[max_insns];
+	ix_decode_batch_t batch;
+	batch.offsets = offsets;
+	batch.lengths = lengths;
+	batch.encodings = encodings;
+	batch.icodes = icodes;
+	batch.status = status;
+
+	size_t pos = 0;
+	size_t batch_base = 0;
+	size_t i = 0;
+	crudasm_intel_decode_batch(&data[0], data.size(), dsz, &batch, max_insns);
+	while(pos < data.size())
+	{
+		if(i == batch.count)
+		{
+			batch_base += batch.next_offset;
+			crudasm_intel_decode_batch(&data[batch_base], data.size() - batch_base, dsz, &batch, max_insns);
+			i = 0;
+		}
+		ix_icode_t icode;
+		ix_decoder_state_t state;
+		const char *s = crudasm_intel_decode(&icode, data.size() - pos, dsz, &data[pos], &state);
+		size_t size = (*s != '\0') ? 1 : state.insn_size;
+		if(batch_base + offsets[i] != pos)
+			fail("batch", dsz, pos, "offset mismatch");
+		else
+		if(lengths[i] != size || strcmp(status[i], s) != 0)
+			fail("batch", dsz, pos, "length/status mismatch");
+		else
+		if(*s == '\0' && (encodings[i] != icode.encoding || !same_icode(icodes[i], icode, dsz)))
+			fail("batch", dsz, pos, "icode mismatch");
+		else
+		if(*s != '\0' && encodings[i] != 0xffffffff)
+			fail("batch", dsz, pos, "invalid entry not flagged");
+		pos += size;
+		++i;
+	}
+	if(i != batch.count || batch_base + batch.next_offset != data.size())
+		fail("batch", dsz, pos, "batch did not end with the buffer");
+}
+
+struct stream_result_t
+{
+	std::vector<U8> offsets;
+	std::vector<U1> sizes;
+	std::vector<ix_icode_t> icodes;
+	std::vector<int> status;
+};
+
+static void stream_callback(void *context, U8 offset, const U1 *bytes, U1 size, ix_icode_t *icode, ix_decoder_state_t *state, int status)
+{
+	stream_result_t *result = (stream_result_t *)(context);
+	result->offsets.push_back(offset);
+	result->sizes.push_back(size);
+	result->icodes.push_back(*icode);
+	result->status.push_back(status);
+}
+
+// The stream decoder must give the same results as a linear sweep, no matter
+// how the input is split into chunks.
+static void test_stream(std::vector<U1> &data, int dsz)
+{
+	const size_t chunk_sizes[] = {1, 2, 7, 29, 30, 31, 64, 1000};
+	for(size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); ++c)
+	{
+		stream_result_t result;
+		crudasm_intel_stream_t stream;
+		crudasm_intel_stream_init(&stream, dsz, 0x1000, stream_callback, &result);
+		for(size_t pos = 0; pos < data.size(); pos += chunk_sizes[c])
+		{
+			// Vary the chunk size a little, so chunks don't always split alike.
+			size_t len = chunk_sizes[c] + (pos & 1);
+			if(len > data.size() - pos)
+				len = data.size() - pos;
+			std::vector<U1> chunk(data.begin() + pos, data.begin() + pos + len);
+			crudasm_intel_stream_feed(&stream, &chunk[0], len);
+			pos += len - chunk_sizes[c];
+		}
+		crudasm_intel_stream_finish(&stream);
+
+		size_t pos = 0;
+		size_t i = 0;
+		for(; pos < data.size() && i < result.offsets.size(); ++i)
+		{
+			ix_icode_t icode;
+			ix_decoder_state_t state;
+			int status = crudasm_intel_decode_status(&icode, data.size() - pos, dsz, &data[pos], &state);
+			size_t size = (status != crudasm_intel_status_ok) ? 1 : state.insn_size;
+			if(result.offsets[i] != 0x1000 + pos || result.sizes[i] != size || result.status[i] != status)
+			{
+				fail("stream", dsz, pos, "offset/size/status mismatch");
+				break;
+			}
+			if(status == crudasm_intel_status_ok && !same_icode(result.icodes[i], icode, dsz))
+				fail("stream", dsz, pos, "icode mismatch");
+			pos += size;
+		}
+		if(pos != data.size() || i != result.offsets.size())
+			fail("stream", dsz, pos, "stream did not end with the data");
+	}
+}
+
+// crudasm_intel_insn_length() must return the same size as a full decode,
+// or 0 wherever a full decode fails.
+static void test_length(std::vector<U1> &data, int dsz)
+{
+	for(size_t pos = 0; pos < data.size(); ++pos)
+	{
+		ix_icode_t icode;
+		ix_decoder_state_t state;
+		const char *s = crudasm_intel_decode(&icode, data.size() - pos, dsz, &data[pos], &state);
+		U1 size = crudasm_intel_insn_length(data.size() - pos, dsz, &data[pos]);
+		if(size != ((*s != '\0') ? 0 : state.insn_size))
+			fail("length", dsz, pos, s);
+	}
+}
+
+// crudasm_intel_decode16/32/64() must agree with crudasm_intel_decode().
+static void test_modes(std::vector<U1> &data, int dsz)
+{
+	for(size_t pos = 0; pos < data.size(); ++pos)
+	{
+		ix_icode_t icode, icode_mode;
+		ix_decoder_state_t state, state_mode;
+		const char *s = crudasm_intel_decode(&icode, data.size() - pos, dsz, &data[pos], &state);
+		const char *s_mode;
+		if(dsz == 0)
+			s_mode = crudasm_intel_decode16(&icode_mode, data.size() - pos, &data[pos], &state_mode);
+		else
+		if(dsz == 1)
+			s_mode = crudasm_intel_decode32(&icode_mode, data.size() - pos, &data[pos], &state_mode);
+		else
+			s_mode = crudasm_intel_decode64(&icode_mode, data.size() - pos, &data[pos], &state_mode);
+		if(strcmp(s, s_mode) != 0)
+			fail("modes", dsz, pos, "status mismatch");
+		else
+		if(*s == '\0' && (state.insn_size != state_mode.insn_size || !same_icode(icode, icode_mode, dsz)))
+			fail("modes", dsz, pos, "icode mismatch");
+	}
+}
+
+// crudasm_intel_decode_status() must agree with crudasm_intel_decode(). If the
+// decoder was built with CRUDASM_DECODE_STATS, the counters must add up too.
+static void test_status(std::vector<U1> &data, int dsz)
+{
+	U8 failures[crudasm_intel_status__count] = {0};
+	crudasm_intel_reset_decode_stats();
+	for(size_t pos = 0; pos < data.size(); ++pos)
+	{
+		ix_icode_t icode;
+		const char *s = crudasm_intel_decode(&icode, data.size() - pos, dsz, &data[pos], NULL);
+		int status = crudasm_intel_decode_status(&icode, data.size() - pos, dsz, &data[pos], NULL);
+		if(strcmp(s, crudasm_intel_status_message(status)) != 0)
+			fail("status", dsz, pos, s);
+		if(status != crudasm_intel_status_ok)
+			failures[status] += 2;
+	}
+
+	crudasm_intel_decode_stats_t stats;
+	crudasm_intel_get_decode_stats(&stats);
+	if(stats.decodes == 0)
+		return;		// not built with CRUDASM_DECODE_STATS
+	if(stats.decodes != 2 * data.size())
+		fail("status", dsz, 0, "wrong decode count");
+	for(int i = 0; i < crudasm_intel_status__count; ++i)
+	{
+		if(stats.failures[i] != failures[i])
+			fail("status", dsz, 0, crudasm_intel_status_message(i));
+	}
+}
+
+// Packing and unpacking an icode must give back exactly what was decoded.
+static void test_pack(std::vector<U1> &data, int dsz)
+{
+	std::vector<ix_packed_side_t> side(1);
+	for(size_t pos = 0; pos < data.size(); ++pos)
+	{
+		ix_icode_t icode, unpacked;
+		ix_packed_icode_t packed;
+		size_t side_count = 0;
+		const char *s = crudasm_intel_decode(&icode, data.size() - pos, dsz, &data[pos], NULL);
+		if(*s != '\0')
+			continue;
+		if(!crudasm_intel_pack_icode(&packed, &icode, dsz, &side[0], &side_count))
+		{
+			fail("pack", dsz, pos, "unable to pack icode");
+			continue;
+		}
+		crudasm_intel_unpack_icode(&unpacked, &packed, &side[0]);
+		bool same = same_icode(icode, unpacked, dsz) && icode.imm == unpacked.imm && icode.disp == unpacked.disp &&
+			icode.ea.index_scale == unpacked.ea.index_scale && icode.ea.disp8 == unpacked.ea.disp8 &&
+			icode.is_nop == unpacked.is_nop && icode.rex_used == unpacked.rex_used;
+		for(int i = 0; i < 4; ++i)
+		{
+			if(icode.argtype[i] != unpacked.argtype[i] || icode.argsize[i] != unpacked.argsize[i] || icode.argvalue[i] != unpacked.argvalue[i])
+				same = false;
+		}
+		if(!same)
+			fail("pack", dsz, pos, "unpacked icode differs");
+	}
+}
+
+// The superset arrays must match crudasm_intel_decode_status() at every offset,
+// also when the buffer is done in separate regions, and the fall-through graph
+// must list every offset whose instruction ends at a given offset.
+static void test_superset(std::vector<U1> &data, int dsz)
+{
+	size_t n = data.size();
+	std::vector<U1> lengths(n), status(n), lengths_split(n), status_split(n);
+	std::vector<U4> encodings(n), encodings_split(n);
+	ix_superset_t out = {&lengths[0], &status[0], &encodings[0]};
+	ix_superset_t out_split = {&lengths_split[0], &status_split[0], &encodings_split[0]};
+
+	crudasm_intel_decode_superset(&data[0], n, dsz, 0, n, &out);
+	crudasm_intel_decode_superset(&data[0], n, dsz, n / 3, n, &out_split);
+	crudasm_intel_decode_superset(&data[0], n, dsz, 0, n / 3, &out_split);
+
+	for(size_t pos = 0; pos < n; ++pos)
+	{
+		ix_icode_t icode;
+		ix_decoder_state_t state;
+		int s = crudasm_intel_decode_status(&icode, n - pos, dsz, &data[pos], &state);
+		if(s != status[pos] || lengths[pos] != ((s == crudasm_intel_status_ok) ? state.insn_size : 0) ||
+			encodings[pos] != ((s == crudasm_intel_status_ok) ? icode.encoding : 0xffffffff))
+			fail("superset", dsz, pos, crudasm_intel_status_message(s));
+		if(lengths_split[pos] != lengths[pos] || status_split[pos] != status[pos] || encodings_split[pos] != encodings[pos])
+			fail("superset", dsz, pos, "split regions differ");
+	}
+
+	std::vector<U4> first(n + 1), preds(n);
+	crudasm_intel_superset_preds(&lengths[0], n, &first[0], &preds[0]);
+	std::vector<U4> seen(n, 0);
+	size_t edges = 0;
+	for(size_t pos = 0; pos < n; ++pos)
+	{
+		if(lengths[pos] != 0 && pos + lengths[pos] < n)
+		{
+			U4 k = first[pos + lengths[pos]] + seen[pos + lengths[pos]]++;
+			if(k >= first[pos + lengths[pos] + 1] || preds[k] != pos)
+				fail("superset", dsz, pos, "missing from fall-through graph");
+			++edges;
+		}
+	}
+	if(first[n] != edges)
+		fail("superset", dsz, n, "fall-through graph has extra edges");
+}
+
+// crudasm_intel_decode_control() must agree with a full decode, and its
+// branch targets with what the disassembler would print.
+static void test_control(std::vector<U1> &data, int dsz)
+{
+	const U8 base = 0x1000;
+	for(size_t pos = 0; pos < data.size(); ++pos)
+	{
+		ix_icode_t icode;
+		ix_decoder_state_t state;
+		ix_control_info_t info;
+		int s = crudasm_intel_decode_status(&icode, data.size() - pos, dsz, &data[pos], &state);
+		U1 size = crudasm_intel_decode_control(&info, data.size() - pos, dsz, &data[pos], base + pos);
+		if(s != crudasm_intel_status_ok)
+		{
+			if(size != 0 || info.encoding != 0xffffffff)
+				fail("control", dsz, pos, "decoded an invalid insn");
+			continue;
+		}
+		if(size != state.insn_size || info.size != size || info.encoding != icode.encoding)
+		{
+			fail("control", dsz, pos, "size or encoding mismatch");
+			continue;
+		}
+
+		const crudasm_intel_encoding_t *encoding = crudasm_intel_encoding_table + icode.encoding;
+		bool xfer = (crudasm_intel_insns[encoding->insn].itags & crudasm_intel_itag_ctrlxfer) != 0;
+		bool relative = (encoding->etags & crudasm_intel_etag_relative) != 0;
+		U2 kind = info.control & crudasm_intel_control_kind;
+		if(info.control != crudasm_intel_control_table[icode.encoding])
+			fail("control", dsz, pos, "wrong control table entry");
+		if((xfer && kind == crudasm_intel_control_none) || ((info.control & crudasm_intel_control_relative) != 0) != relative)
+			fail("control", dsz, pos, "wrong flags");
+		if(relative && ((info.control & crudasm_intel_control_rel8) != 0) != (icode.sx != 0))
+			fail("control", dsz, pos, "wrong displacement size");
+		if(state.opcode0 == 0xe8 && kind != crudasm_intel_control_call)
+			fail("control", dsz, pos, "call not classified");
+		if(state.opcode0 >= 0x70 && state.opcode0 <= 0x7f && kind != crudasm_intel_control_jcc)
+			fail("control", dsz, pos, "jcc not classified");
+		if(state.opcode0 == 0xc3 && (kind != crudasm_intel_control_ret || !(info.control & crudasm_intel_control_terminal)))
+			fail("control", dsz, pos, "ret not classified");
+
+		U8 target = 0;
+		if(relative)
+		{
+			// imm is sign extended to the operand size, but with 66 in 64bit
+			// mode the displacement can still be 32 bits; go by its size.
+			int imm_bits = 8 * (size - state.imm1_offset);
+			target = base + pos + size + (U8)((S8)((U8)(icode.imm) << (64 - imm_bits)) >> (64 - imm_bits));
+			if(dsz != 2)
+				target &= (icode.osz == 0) ? TULL(0xffff) : TULL(0xffffffff);
+		}
+		if(info.target != target)
+			fail("control", dsz, pos, "wrong branch target");
+	}
+}
+
+// crudasm_intel_decode_cached() must agree with crudasm_intel_decode_status(),
+// whether or not it hits. Two passes over the data, so the second one hits.
+static void test_cache(std::vector<U1> &data, int dsz)
+{
+	crudasm_intel_decode_cache_t *cache = new crudasm_intel_decode_cache_t;
+	crudasm_intel_decode_cache_init(cache);
+	for(int pass = 0; pass < 2; ++pass)
+	{
+		for(size_t pos = 0; pos < data.size(); ++pos)
+		{
+			ix_icode_t icode, icode_cached;
+			ix_decoder_state_t state, state_cached;
+			int s = crudasm_intel_decode_status(&icode, data.size() - pos, dsz, &data[pos], &state);
+			int s_cached = crudasm_intel_decode_cached(cache, &icode_cached, data.size() - pos, dsz, &data[pos], &state_cached);
+			if(s != s_cached)
+				fail("cache", dsz, pos, "status mismatch");
+			else
+			if(s == crudasm_intel_status_ok && (state.insn_size != state_cached.insn_size || !same_icode(icode, icode_cached, dsz)))
+				fail("cache", dsz, pos, "icode mismatch");
+		}
+	}
+	if(cache->lookups != 2 * data.size() || cache->hits == 0 || cache->hits + cache->uncacheable > cache->lookups)
+		fail("cache", dsz, 0, "bad statistics");
+	delete cache;
+}
+
+// crudasm_intel_disasm_n() must never write past dest_size bytes, and what it
+// writes into a buffer that's too small must be the start of the full text.
+static void test_disasm_bounds(std::vector<U1> &data, int dsz)
+{
+	for(size_t pos = 0; pos < data.size(); ++pos)
+	{
+		ix_icode_t icode;
+		char full[1024], part[1024];
+		const char *s = crudasm_intel_decode(&icode, data.size() - pos, dsz, &data[pos], NULL);
+		if(*s != '\0')
+			continue;
+		int len = crudasm_intel_disasm_n(&icode, pos, full, sizeof(full), "sym_imm", "sym_disp", dsz);
+		if(len < 0 || (size_t)(len) != strlen(full))
+		{
+			fail("disasm bounds", dsz, pos, "bad length");
+			continue;
+		}
+		size_t sizes[4] = {1, (size_t)(len) / 2 + 1, (size_t)(len), (size_t)(len) + 1};
+		for(int i = 0; i < 4; ++i)
+		{
+			memset(part, '#', sizeof(part));
+			int part_len = crudasm_intel_disasm_n(&icode, pos, part, sizes[i], "sym_imm", "sym_disp", dsz);
+			if(part_len != ((sizes[i] > (size_t)(len)) ? len : -1) || part[sizes[i]] != '#' ||
+				strlen(part) != sizes[i] - 1 || strncmp(part, full, strlen(part)) != 0)
+			{
+				fail("disasm bounds", dsz, pos, full);
+				break;
+			}
+		}
+	}
+}
+
+// Grows a crudasm_intel_disasm_sink_t kept in the std::vector<char> at sink->user,
+// a few bytes at a time so that most lines need it more than once.
+static int grow_sink(crudasm_intel_disasm_sink_t *sink, size_t need)
+{
+	std::vector<char> &buf = *(std::vector<char> *)(sink->user);
+	buf.resize(sink->pos + need + 3);
+	sink->buf = &buf[0];
+	sink->size = buf.size();
+	return 1;
+}
+
+// crudasm_intel_disasm_sink() must append the same text as crudasm_intel_disasm_n(),
+// right after whatever is already in the sink.
+static void test_disasm_sink(std::vector<U1> &data, int dsz)
+{
+	std::vector<char> buf(1);
+	crudasm_intel_disasm_sink_t sink;
+	sink.buf = &buf[0];
+	sink.pos = 0;
+	sink.size = buf.size();
+	sink.grow = grow_sink;
+	sink.user = &buf;
+	sink.truncated = 0;
+	for(size_t pos = 0; pos < data.size(); ++pos)
+	{
+		ix_icode_t icode;
+		char full[1024];
+		const char *s = crudasm_intel_decode(&icode, data.size() - pos, dsz, &data[pos], NULL);
+		if(*s != '\0')
+			continue;
+		int len = crudasm_intel_disasm_n(&icode, pos, full, sizeof(full), "sym_imm", "sym_disp", dsz);
+		size_t start = sink.pos;
+		crudasm_intel_sink_write(&sink, "loc_", 4);
+		crudasm_intel_sink_write_hex(&sink, (U4)(pos), 8);
+		crudasm_intel_sink_write(&sink, ":  ", 3);
+		int sink_len = crudasm_intel_disasm_sink(&sink, &icode, pos, "sym_imm", "sym_disp", dsz);
+		if(sink_len != len || sink.truncated || sink.pos != start + 15 + len || memcmp(&buf[start + 15], full, len) != 0)
+			fail("disasm sink", dsz, pos, full);
+		if(sink.pos > 65536)
+			sink.pos = 0;
+	}
+}
+
+// crudasm_intel_disasm_tokens() must write the same text as crudasm_intel_disasm_n(),
+// with tokens that stay inside it and say sensible things about it.
+static void test_disasm_tokens(std::vector<U1> &data, int dsz)
+{
+	std::vector<char> buf(256);
+	crudasm_intel_disasm_sink_t sink;
+	sink.buf = &buf[0];
+	sink.size = buf.size();
+	sink.grow = NULL;
+	sink.user = NULL;
+	sink.truncated = 0;
+	for(size_t pos = 0; pos < data.size(); ++pos)
+	{
+		ix_icode_t icode;
+		char full[1024];
+		crudasm_intel_disasm_token_t tokens[crudasm_intel_disasm_max_tokens];
+		size_t num_tokens, mnemonics = 0, end = 0;
+		const char *s = crudasm_intel_decode(&icode, data.size() - pos, dsz, &data[pos], NULL);
+		if(*s != '\0')
+			continue;
+		int len = crudasm_intel_disasm_n(&icode, pos, full, sizeof(full), NULL, NULL, dsz);
+		sink.pos = 0;
+		int tok_len = crudasm_intel_disasm_tokens(&sink, &icode, pos, NULL, NULL, dsz, tokens, crudasm_intel_disasm_max_tokens, &num_tokens);
+		if(tok_len != len || memcmp(&buf[0], full, len) != 0)
+		{
+			fail("disasm tokens text", dsz, pos, full);
+			continue;
+		}
+		for(size_t i = 0; i < num_tokens; ++i)
+		{
+			const crudasm_intel_disasm_token_t &t = tokens[i];
+			std::string text(&buf[0] + t.offset, t.length);
+			if(t.length == 0 || (int)(t.offset + t.length) > len || (i != 0 && t.offset < tokens[i - 1].offset))
+				fail("disasm tokens bounds", dsz, pos, full);
+			else
+			if(t.kind == crudasm_intel_disasm_token_mnemonic)
+				++mnemonics;
+			else
+			if(t.kind == crudasm_intel_disasm_token_memory && text[text.size() - 1] != ']')
+				fail("disasm tokens memory", dsz, pos, full);
+			else
+			if(t.kind == crudasm_intel_disasm_token_target && text.find("$$+") == std::string::npos)
+				fail("disasm tokens target", dsz, pos, full);
+			else
+			if(t.kind == crudasm_intel_disasm_token_register && text.find(' ') != std::string::npos)
+				fail("disasm tokens register", dsz, pos, full);
+			if(t.kind != crudasm_intel_disasm_token_register && t.offset < end)
+				fail("disasm tokens overlap", dsz, pos, full);
+			if(t.kind != crudasm_intel_disasm_token_register || t.offset >= end)
+				end = t.offset + t.length;
+		}
+		if(len != 0 && mnemonics != 1)
+			fail("disasm tokens mnemonic", dsz, pos, full);
+	}
+}
+
+// crudasm_intel_disasm_batch() on the output of crudasm_intel_decode_batch() must give
+// the same text as crudasm_intel_disasm_n() one instruction at a time. The sink is kept
+// small and can't grow, to exercise stopping and carrying on.
+static void test_disasm_batch(std::vector<U1> &data, int dsz)
+{
+	const size_t max_insns = 100;
+	U8 offsets[max_insns], rels[max_insns];
+	U1 lengths[max_insns];
+	U4 encodings[max_insns];
+	ix_icode_t icodes[max_insns];
+	crudasm_intel_disasm_span_t spans[max_insns];
+	ix_decode_batch_t batch;
+	batch.offsets = offsets;
+	batch.lengths = lengths;
+	batch.encodings = encodings;
+	batch.icodes = icodes;
+	batch.status = NULL;
+
+	char buf[512];
+	crudasm_intel_disasm_sink_t sink;
+	sink.buf = buf;
+	sink.size = sizeof(buf);
+	sink.grow = NULL;
+	sink.user = NULL;
+	for(size_t base = 0; base < data.size(); base += batch.next_offset)
+	{
+		crudasm_intel_decode_batch(&data[base], data.size() - base, dsz, &batch, max_insns);
+		for(size_t i = 0; i < batch.count; ++i)
+			rels[i] = base + offsets[i] + lengths[i];
+		for(size_t i = 0; i < batch.count; )
+		{
+			sink.pos = 0;
+			sink.truncated = 0;
+			size_t done = crudasm_intel_disasm_batch(&sink, icodes + i, rels + i, batch.count - i, dsz, spans + i);
+			if(i + done != batch.count && (done == 0 || !sink.truncated))
+			{
+				fail("disasm batch", dsz, base + offsets[i], "stopped without progress");
+				break;
+			}
+			if(spans[i + done - 1].offset + spans[i + done - 1].length != sink.pos)
+				fail("disasm batch", dsz, base + offsets[i], "sink position");
+			for(size_t end = i + done; i < end; ++i)
+			{
+				char full[1024];
+				int len = crudasm_intel_disasm_n(&icodes[i], rels[i], full, sizeof(full), NULL, NULL, dsz);
+				if(encodings[i] == 0xffffffff)
+					len = 0;
+				if(spans[i].length != (size_t)(len) || memcmp(buf + spans[i].offset, full, len) != 0)
+					fail("disasm batch", dsz, base + offsets[i], full);
+			}
+		}
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const char *fnames[3] = {"test16.bin", "test32.bin", "test64.bin"};
+
+	for(int f = 0; f < 3; ++f)
+	{
+		std::vector<U1> data;
+		if(!load_file(fnames[f], data))
+		{
+			std::cout << "error: unable to read " << fnames[f] << " (run test1 first)" << std::endl;
+			return 1;
+		}
+		for(int dsz = 0; dsz <= 2; ++dsz)
+		{
+			test_modes(data, dsz);
+			test_status(data, dsz);
+			test_batch(data, dsz);
+			test_pack(data, dsz);
+			test_stream(data, dsz);
+			test_length(data, dsz);
+			test_superset(data, dsz);
+			test_cache(data, dsz);
+			test_control(data, dsz);
+			test_disasm_bounds(data, dsz);
+			test_disasm_sink(data, dsz);
+			test_disasm_tokens(data, dsz);
+			test_disasm_batch(data, dsz);
+		}
+	}
+
+	if(g_failures != 0)
+	{
+		std::cout << g_failures << " failure(s)" << std::endl;
+		return 1;
+	}
+	std::cout << "all tests passed" << std::endl;
+	return 0;
+}
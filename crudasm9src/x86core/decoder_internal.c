@@ -3,5 +3,10 @@
 #include "../crudasm_intel_include.h"
 
 #include "../generated/out_intel_encoding_table.h"
+#include "../generated/out_intel_hot_table.h"
 #include "../generated/out_intel_decoder_table.h"
+#include "../generated/out_intel_length_table.h"
+#include "../generated/out_intel_control_table.h"
+#include "../generated/out_intel_argsize_table.h"
 #include "../generated/out_intel_insn_table.h"
+#include "../generated/out_intel_token_table.h"
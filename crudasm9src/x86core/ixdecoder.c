@@ -4,6 +4,14 @@
 #include "ixdecoder.h"
 #include <stddef.h>
 #include <stdio.h>
+#include <string.h>
+
+// On little endian hosts that can do unaligned loads, fetch_le() reads
+// multibyte fields with a single load. Define IX_NO_UNALIGNED_LOADS to
+// always read them a byte at a time.
+#if !defined(IX_NO_UNALIGNED_LOADS) && (defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__))
+#define IX_LITTLE_ENDIAN_UNALIGNED
+#endif
 
 //===============================================================================================//
 
@@ -22,6 +30,8 @@ struct decode_prefix_state_t
 
 	U2 rex_used : 1;
 	U2 wait_used : 1;
+
+	U1 wait_offset;		// offset of the FWAIT, if wait_used (reset_prefix() leaves it alone)
 };
 
 struct code_fetcher_t
@@ -39,7 +49,7 @@ static int fetch_byte(struct code_fetcher_t *fetcher, U1 *c)
 	return 1;
 }
 
-static int accept_byte(struct code_fetcher_t *fetcher)
+static void accept_byte(struct code_fetcher_t *fetcher)
 {
 	--fetcher->bytes_left;
 	++fetcher->next_offset;
@@ -72,858 +82,1167 @@ static U8 SHL64(U8 src, U1 value)
 	return src << (value - 32);
 }
 
-static int decode_modrm_16(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, U2 dsz, struct decode_prefix_state_t *p, U1 c, int *disp_size, struct ix_decoder_state_t *state);
-static int decode_modrm_32(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, U2 dsz, struct decode_prefix_state_t *p, U1 c, int *disp_size, int mode64, struct ix_decoder_state_t *state);
-static int decode_modrm_64(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, U2 dsz, struct decode_prefix_state_t *p, U1 c, int *disp_size, struct ix_decoder_state_t *state);
-
-// pre: dest->asz must be set already.
-static int get_modrm(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, U2 dsz, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state)
+// Fetches and accepts a little endian field of size bytes. Sizes 1, 2, 4
+// and 8 are read with a single load where the host allows it.
+// Returns 0 if out of bytes.
+static int fetch_le(struct code_fetcher_t *fetcher, U1 size, U8 *value)
 {
-	U1 c;
-	int x, disp_size;
-	int i;
-
-	state->modrm_offset = fetcher->next_offset;
+	U1 *src;
+	U1 i;
+#ifdef IX_LITTLE_ENDIAN_UNALIGNED
+	U2 v2;
+	U4 v4;
+#endif
 
-	if(!fetch_byte(fetcher, &c))
+	if(fetcher->bytes_left < size)
 		return 0;
-	accept_byte(fetcher);
-	state->modrm0 = c;
-	state->has_modrm = 1;
-	dest->disp = 0;		// no displacement yet
+	src = fetcher->buf + fetcher->next_offset;
+	fetcher->bytes_left -= size;
+	fetcher->next_offset += size;
 
-	if(c >= 0xc0)
-		return 1;	// register form
+#ifdef IX_LITTLE_ENDIAN_UNALIGNED
+	switch(size)
+	{
+	case 1:
+		*value = *src;
+		break;
+	case 2:
+		memcpy(&v2, src, 2);
+		*value = v2;
+		break;
+	case 4:
+		memcpy(&v4, src, 4);
+		*value = v4;
+		break;
+	case 8:
+		memcpy(value, src, 8);
+		break;
+	default:
+		*value = 0;
+		for(i = 0; i < size; ++i)
+			*value |= SHL64((U8)(src[i]), 8 * i);
+		break;
+	}
+#else
+	*value = 0;
+	for(i = 0; i < size; ++i)
+		*value |= SHL64((U8)(src[i]), 8 * i);
+#endif
+	return 1;
+}
 
-	if(dsz == 2)
-		x = decode_modrm_64(fetcher, dest, dsz, p, c, &disp_size, state);
-	else
-	if(dest->asz == 0)
-		x = decode_modrm_16(fetcher, dest, dsz, p, c, &disp_size, state);
-	else
-		x = decode_modrm_32(fetcher, dest, dsz, p, c, &disp_size, 0, state);
+// Memory operand descriptors for get_modrm() and skip_modrm(). A modr/m
+// descriptor is indexed by (mod << 3) | rm. base and index are 31 if unused.
+struct modrm_desc_t
+{
+	U1 base;
+	U1 index;
+	U1 disp_size;	// in bytes
+	U1 sib_row;		// 0 if there's no sib byte, else row of sib_desc[] plus 1
+};
 
-	if(x != 0)
-		return 0;
+// A sib descriptor is indexed by the sib byte. Row 0 is for mod 1 and 2,
+// row 1 is for mod 0 (where base 5 means no base, with a 32 bit displacement).
+struct sib_desc_t
+{
+	U1 base;
+	U1 index;
+	U1 index_scale;
+	U1 disp_size;	// in bytes, added to the modr/m descriptor's disp_size
+};
 
-	// Handle displacement.
-	if(disp_size > 0)
+// 16 bit addressing: [bx+si] [bx+di] [bp+si] [bp+di] [si] [di] [bp] [bx]
+static const struct modrm_desc_t modrm_desc_16[32] =
+{
+	{3, 6, 0, 0}, {3, 7, 0, 0}, {5, 6, 0, 0}, {5, 7, 0, 0}, {31, 6, 0, 0}, {31, 7, 0, 0}, {31, 31, 2, 0}, {3, 31, 0, 0},
+	{3, 6, 1, 0}, {3, 7, 1, 0}, {5, 6, 1, 0}, {5, 7, 1, 0}, {31, 6, 1, 0}, {31, 7, 1, 0}, {5, 31, 1, 0}, {3, 31, 1, 0},
+	{3, 6, 2, 0}, {3, 7, 2, 0}, {5, 6, 2, 0}, {5, 7, 2, 0}, {31, 6, 2, 0}, {31, 7, 2, 0}, {5, 31, 2, 0}, {3, 31, 2, 0},
+	{31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}
+};
+
+// 32 and 64 bit addressing
+static const struct modrm_desc_t modrm_desc_32[32] =
+{
+	{0, 31, 0, 0}, {1, 31, 0, 0}, {2, 31, 0, 0}, {3, 31, 0, 0}, {31, 31, 0, 2}, {31, 31, 4, 0}, {6, 31, 0, 0}, {7, 31, 0, 0},
+	{0, 31, 1, 0}, {1, 31, 1, 0}, {2, 31, 1, 0}, {3, 31, 1, 0}, {31, 31, 1, 1}, {5, 31, 1, 0}, {6, 31, 1, 0}, {7, 31, 1, 0},
+	{0, 31, 4, 0}, {1, 31, 4, 0}, {2, 31, 4, 0}, {3, 31, 4, 0}, {31, 31, 4, 1}, {5, 31, 4, 0}, {6, 31, 4, 0}, {7, 31, 4, 0},
+	{31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}, {31, 31, 0, 0}
+};
+
+static const struct sib_desc_t sib_desc[2][256] =
+{
 	{
-		dest->has_disp = 1;
-		state->disp_offset = (U1)(fetcher->next_offset);
-		dest->disp = 0;			// redundant
-		for(i = 0; i < disp_size; ++i)
-		{
-			if(!fetch_byte(fetcher, &c))
-				return 0;
-			accept_byte(fetcher);
-			//dest->disp = (dest->disp << 8) | static_cast<U4>(c);
-			dest->disp |= SHL64((U8)(c), 8 * i);
-		}
-		if(disp_size == 1)
-		{
-			dest->ea.disp8 = 1;	// forgot this the 1st time (fixed 2/1/2011)
-			if(dest->asz == 0)
-				dest->disp = (U4)(U2)(S2)(S1)(dest->disp);
-			else
-				dest->disp = (U4)(S4)(S1)(dest->disp);
-		}
+		{0, 0, 0, 0}, {1, 0, 0, 0}, {2, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {5, 0, 0, 0}, {6, 0, 0, 0}, {7, 0, 0, 0},
+		{0, 1, 0, 0}, {1, 1, 0, 0}, {2, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {5, 1, 0, 0}, {6, 1, 0, 0}, {7, 1, 0, 0},
+		{0, 2, 0, 0}, {1, 2, 0, 0}, {2, 2, 0, 0}, {3, 2, 0, 0}, {4, 2, 0, 0}, {5, 2, 0, 0}, {6, 2, 0, 0}, {7, 2, 0, 0},
+		{0, 3, 0, 0}, {1, 3, 0, 0}, {2, 3, 0, 0}, {3, 3, 0, 0}, {4, 3, 0, 0}, {5, 3, 0, 0}, {6, 3, 0, 0}, {7, 3, 0, 0},
+		{0, 31, 0, 0}, {1, 31, 0, 0}, {2, 31, 0, 0}, {3, 31, 0, 0}, {4, 31, 0, 0}, {5, 31, 0, 0}, {6, 31, 0, 0}, {7, 31, 0, 0},
+		{0, 5, 0, 0}, {1, 5, 0, 0}, {2, 5, 0, 0}, {3, 5, 0, 0}, {4, 5, 0, 0}, {5, 5, 0, 0}, {6, 5, 0, 0}, {7, 5, 0, 0},
+		{0, 6, 0, 0}, {1, 6, 0, 0}, {2, 6, 0, 0}, {3, 6, 0, 0}, {4, 6, 0, 0}, {5, 6, 0, 0}, {6, 6, 0, 0}, {7, 6, 0, 0},
+		{0, 7, 0, 0}, {1, 7, 0, 0}, {2, 7, 0, 0}, {3, 7, 0, 0}, {4, 7, 0, 0}, {5, 7, 0, 0}, {6, 7, 0, 0}, {7, 7, 0, 0},
+		{0, 0, 1, 0}, {1, 0, 1, 0}, {2, 0, 1, 0}, {3, 0, 1, 0}, {4, 0, 1, 0}, {5, 0, 1, 0}, {6, 0, 1, 0}, {7, 0, 1, 0},
+		{0, 1, 1, 0}, {1, 1, 1, 0}, {2, 1, 1, 0}, {3, 1, 1, 0}, {4, 1, 1, 0}, {5, 1, 1, 0}, {6, 1, 1, 0}, {7, 1, 1, 0},
+		{0, 2, 1, 0}, {1, 2, 1, 0}, {2, 2, 1, 0}, {3, 2, 1, 0}, {4, 2, 1, 0}, {5, 2, 1, 0}, {6, 2, 1, 0}, {7, 2, 1, 0},
+		{0, 3, 1, 0}, {1, 3, 1, 0}, {2, 3, 1, 0}, {3, 3, 1, 0}, {4, 3, 1, 0}, {5, 3, 1, 0}, {6, 3, 1, 0}, {7, 3, 1, 0},
+		{0, 31, 0, 0}, {1, 31, 0, 0}, {2, 31, 0, 0}, {3, 31, 0, 0}, {4, 31, 0, 0}, {5, 31, 0, 0}, {6, 31, 0, 0}, {7, 31, 0, 0},
+		{0, 5, 1, 0}, {1, 5, 1, 0}, {2, 5, 1, 0}, {3, 5, 1, 0}, {4, 5, 1, 0}, {5, 5, 1, 0}, {6, 5, 1, 0}, {7, 5, 1, 0},
+		{0, 6, 1, 0}, {1, 6, 1, 0}, {2, 6, 1, 0}, {3, 6, 1, 0}, {4, 6, 1, 0}, {5, 6, 1, 0}, {6, 6, 1, 0}, {7, 6, 1, 0},
+		{0, 7, 1, 0}, {1, 7, 1, 0}, {2, 7, 1, 0}, {3, 7, 1, 0}, {4, 7, 1, 0}, {5, 7, 1, 0}, {6, 7, 1, 0}, {7, 7, 1, 0},
+		{0, 0, 2, 0}, {1, 0, 2, 0}, {2, 0, 2, 0}, {3, 0, 2, 0}, {4, 0, 2, 0}, {5, 0, 2, 0}, {6, 0, 2, 0}, {7, 0, 2, 0},
+		{0, 1, 2, 0}, {1, 1, 2, 0}, {2, 1, 2, 0}, {3, 1, 2, 0}, {4, 1, 2, 0}, {5, 1, 2, 0}, {6, 1, 2, 0}, {7, 1, 2, 0},
+		{0, 2, 2, 0}, {1, 2, 2, 0}, {2, 2, 2, 0}, {3, 2, 2, 0}, {4, 2, 2, 0}, {5, 2, 2, 0}, {6, 2, 2, 0}, {7, 2, 2, 0},
+		{0, 3, 2, 0}, {1, 3, 2, 0}, {2, 3, 2, 0}, {3, 3, 2, 0}, {4, 3, 2, 0}, {5, 3, 2, 0}, {6, 3, 2, 0}, {7, 3, 2, 0},
+		{0, 31, 0, 0}, {1, 31, 0, 0}, {2, 31, 0, 0}, {3, 31, 0, 0}, {4, 31, 0, 0}, {5, 31, 0, 0}, {6, 31, 0, 0}, {7, 31, 0, 0},
+		{0, 5, 2, 0}, {1, 5, 2, 0}, {2, 5, 2, 0}, {3, 5, 2, 0}, {4, 5, 2, 0}, {5, 5, 2, 0}, {6, 5, 2, 0}, {7, 5, 2, 0},
+		{0, 6, 2, 0}, {1, 6, 2, 0}, {2, 6, 2, 0}, {3, 6, 2, 0}, {4, 6, 2, 0}, {5, 6, 2, 0}, {6, 6, 2, 0}, {7, 6, 2, 0},
+		{0, 7, 2, 0}, {1, 7, 2, 0}, {2, 7, 2, 0}, {3, 7, 2, 0}, {4, 7, 2, 0}, {5, 7, 2, 0}, {6, 7, 2, 0}, {7, 7, 2, 0},
+		{0, 0, 3, 0}, {1, 0, 3, 0}, {2, 0, 3, 0}, {3, 0, 3, 0}, {4, 0, 3, 0}, {5, 0, 3, 0}, {6, 0, 3, 0}, {7, 0, 3, 0},
+		{0, 1, 3, 0}, {1, 1, 3, 0}, {2, 1, 3, 0}, {3, 1, 3, 0}, {4, 1, 3, 0}, {5, 1, 3, 0}, {6, 1, 3, 0}, {7, 1, 3, 0},
+		{0, 2, 3, 0}, {1, 2, 3, 0}, {2, 2, 3, 0}, {3, 2, 3, 0}, {4, 2, 3, 0}, {5, 2, 3, 0}, {6, 2, 3, 0}, {7, 2, 3, 0},
+		{0, 3, 3, 0}, {1, 3, 3, 0}, {2, 3, 3, 0}, {3, 3, 3, 0}, {4, 3, 3, 0}, {5, 3, 3, 0}, {6, 3, 3, 0}, {7, 3, 3, 0},
+		{0, 31, 0, 0}, {1, 31, 0, 0}, {2, 31, 0, 0}, {3, 31, 0, 0}, {4, 31, 0, 0}, {5, 31, 0, 0}, {6, 31, 0, 0}, {7, 31, 0, 0},
+		{0, 5, 3, 0}, {1, 5, 3, 0}, {2, 5, 3, 0}, {3, 5, 3, 0}, {4, 5, 3, 0}, {5, 5, 3, 0}, {6, 5, 3, 0}, {7, 5, 3, 0},
+		{0, 6, 3, 0}, {1, 6, 3, 0}, {2, 6, 3, 0}, {3, 6, 3, 0}, {4, 6, 3, 0}, {5, 6, 3, 0}, {6, 6, 3, 0}, {7, 6, 3, 0},
+		{0, 7, 3, 0}, {1, 7, 3, 0}, {2, 7, 3, 0}, {3, 7, 3, 0}, {4, 7, 3, 0}, {5, 7, 3, 0}, {6, 7, 3, 0}, {7, 7, 3, 0}
+	},
+	{
+		{0, 0, 0, 0}, {1, 0, 0, 0}, {2, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {31, 0, 0, 4}, {6, 0, 0, 0}, {7, 0, 0, 0},
+		{0, 1, 0, 0}, {1, 1, 0, 0}, {2, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {31, 1, 0, 4}, {6, 1, 0, 0}, {7, 1, 0, 0},
+		{0, 2, 0, 0}, {1, 2, 0, 0}, {2, 2, 0, 0}, {3, 2, 0, 0}, {4, 2, 0, 0}, {31, 2, 0, 4}, {6, 2, 0, 0}, {7, 2, 0, 0},
+		{0, 3, 0, 0}, {1, 3, 0, 0}, {2, 3, 0, 0}, {3, 3, 0, 0}, {4, 3, 0, 0}, {31, 3, 0, 4}, {6, 3, 0, 0}, {7, 3, 0, 0},
+		{0, 31, 0, 0}, {1, 31, 0, 0}, {2, 31, 0, 0}, {3, 31, 0, 0}, {4, 31, 0, 0}, {31, 31, 0, 4}, {6, 31, 0, 0}, {7, 31, 0, 0},
+		{0, 5, 0, 0}, {1, 5, 0, 0}, {2, 5, 0, 0}, {3, 5, 0, 0}, {4, 5, 0, 0}, {31, 5, 0, 4}, {6, 5, 0, 0}, {7, 5, 0, 0},
+		{0, 6, 0, 0}, {1, 6, 0, 0}, {2, 6, 0, 0}, {3, 6, 0, 0}, {4, 6, 0, 0}, {31, 6, 0, 4}, {6, 6, 0, 0}, {7, 6, 0, 0},
+		{0, 7, 0, 0}, {1, 7, 0, 0}, {2, 7, 0, 0}, {3, 7, 0, 0}, {4, 7, 0, 0}, {31, 7, 0, 4}, {6, 7, 0, 0}, {7, 7, 0, 0},
+		{0, 0, 1, 0}, {1, 0, 1, 0}, {2, 0, 1, 0}, {3, 0, 1, 0}, {4, 0, 1, 0}, {31, 0, 1, 4}, {6, 0, 1, 0}, {7, 0, 1, 0},
+		{0, 1, 1, 0}, {1, 1, 1, 0}, {2, 1, 1, 0}, {3, 1, 1, 0}, {4, 1, 1, 0}, {31, 1, 1, 4}, {6, 1, 1, 0}, {7, 1, 1, 0},
+		{0, 2, 1, 0}, {1, 2, 1, 0}, {2, 2, 1, 0}, {3, 2, 1, 0}, {4, 2, 1, 0}, {31, 2, 1, 4}, {6, 2, 1, 0}, {7, 2, 1, 0},
+		{0, 3, 1, 0}, {1, 3, 1, 0}, {2, 3, 1, 0}, {3, 3, 1, 0}, {4, 3, 1, 0}, {31, 3, 1, 4}, {6, 3, 1, 0}, {7, 3, 1, 0},
+		{0, 31, 0, 0}, {1, 31, 0, 0}, {2, 31, 0, 0}, {3, 31, 0, 0}, {4, 31, 0, 0}, {31, 31, 0, 4}, {6, 31, 0, 0}, {7, 31, 0, 0},
+		{0, 5, 1, 0}, {1, 5, 1, 0}, {2, 5, 1, 0}, {3, 5, 1, 0}, {4, 5, 1, 0}, {31, 5, 1, 4}, {6, 5, 1, 0}, {7, 5, 1, 0},
+		{0, 6, 1, 0}, {1, 6, 1, 0}, {2, 6, 1, 0}, {3, 6, 1, 0}, {4, 6, 1, 0}, {31, 6, 1, 4}, {6, 6, 1, 0}, {7, 6, 1, 0},
+		{0, 7, 1, 0}, {1, 7, 1, 0}, {2, 7, 1, 0}, {3, 7, 1, 0}, {4, 7, 1, 0}, {31, 7, 1, 4}, {6, 7, 1, 0}, {7, 7, 1, 0},
+		{0, 0, 2, 0}, {1, 0, 2, 0}, {2, 0, 2, 0}, {3, 0, 2, 0}, {4, 0, 2, 0}, {31, 0, 2, 4}, {6, 0, 2, 0}, {7, 0, 2, 0},
+		{0, 1, 2, 0}, {1, 1, 2, 0}, {2, 1, 2, 0}, {3, 1, 2, 0}, {4, 1, 2, 0}, {31, 1, 2, 4}, {6, 1, 2, 0}, {7, 1, 2, 0},
+		{0, 2, 2, 0}, {1, 2, 2, 0}, {2, 2, 2, 0}, {3, 2, 2, 0}, {4, 2, 2, 0}, {31, 2, 2, 4}, {6, 2, 2, 0}, {7, 2, 2, 0},
+		{0, 3, 2, 0}, {1, 3, 2, 0}, {2, 3, 2, 0}, {3, 3, 2, 0}, {4, 3, 2, 0}, {31, 3, 2, 4}, {6, 3, 2, 0}, {7, 3, 2, 0},
+		{0, 31, 0, 0}, {1, 31, 0, 0}, {2, 31, 0, 0}, {3, 31, 0, 0}, {4, 31, 0, 0}, {31, 31, 0, 4}, {6, 31, 0, 0}, {7, 31, 0, 0},
+		{0, 5, 2, 0}, {1, 5, 2, 0}, {2, 5, 2, 0}, {3, 5, 2, 0}, {4, 5, 2, 0}, {31, 5, 2, 4}, {6, 5, 2, 0}, {7, 5, 2, 0},
+		{0, 6, 2, 0}, {1, 6, 2, 0}, {2, 6, 2, 0}, {3, 6, 2, 0}, {4, 6, 2, 0}, {31, 6, 2, 4}, {6, 6, 2, 0}, {7, 6, 2, 0},
+		{0, 7, 2, 0}, {1, 7, 2, 0}, {2, 7, 2, 0}, {3, 7, 2, 0}, {4, 7, 2, 0}, {31, 7, 2, 4}, {6, 7, 2, 0}, {7, 7, 2, 0},
+		{0, 0, 3, 0}, {1, 0, 3, 0}, {2, 0, 3, 0}, {3, 0, 3, 0}, {4, 0, 3, 0}, {31, 0, 3, 4}, {6, 0, 3, 0}, {7, 0, 3, 0},
+		{0, 1, 3, 0}, {1, 1, 3, 0}, {2, 1, 3, 0}, {3, 1, 3, 0}, {4, 1, 3, 0}, {31, 1, 3, 4}, {6, 1, 3, 0}, {7, 1, 3, 0},
+		{0, 2, 3, 0}, {1, 2, 3, 0}, {2, 2, 3, 0}, {3, 2, 3, 0}, {4, 2, 3, 0}, {31, 2, 3, 4}, {6, 2, 3, 0}, {7, 2, 3, 0},
+		{0, 3, 3, 0}, {1, 3, 3, 0}, {2, 3, 3, 0}, {3, 3, 3, 0}, {4, 3, 3, 0}, {31, 3, 3, 4}, {6, 3, 3, 0}, {7, 3, 3, 0},
+		{0, 31, 0, 0}, {1, 31, 0, 0}, {2, 31, 0, 0}, {3, 31, 0, 0}, {4, 31, 0, 0}, {31, 31, 0, 4}, {6, 31, 0, 0}, {7, 31, 0, 0},
+		{0, 5, 3, 0}, {1, 5, 3, 0}, {2, 5, 3, 0}, {3, 5, 3, 0}, {4, 5, 3, 0}, {31, 5, 3, 4}, {6, 5, 3, 0}, {7, 5, 3, 0},
+		{0, 6, 3, 0}, {1, 6, 3, 0}, {2, 6, 3, 0}, {3, 6, 3, 0}, {4, 6, 3, 0}, {31, 6, 3, 4}, {6, 6, 3, 0}, {7, 6, 3, 0},
+		{0, 7, 3, 0}, {1, 7, 3, 0}, {2, 7, 3, 0}, {3, 7, 3, 0}, {4, 7, 3, 0}, {31, 7, 3, 4}, {6, 7, 3, 0}, {7, 7, 3, 0}
 	}
+};
+
+// Returns which of the CRUDASM_ARGSIZE_COMBOS (dsz, osz, asz) combinations of
+// crudasm_intel_argsize_rows[] applies. 16 and 32 bit modes only differ in
+// their defaults, so they share the first four.
+static U1 argsize_combo(U1 dsz, U1 osz, U1 asz)
+{
+	if(dsz == 2)
+		return 4 + 2 * osz + (asz - 1);
+	return 2 * osz + asz;
+}
 
-	if(p->sreg == 7 && dest->ea.base != 31 && (dest->ea.base & 6) == 4)
-		dest->ea.sreg = 6;		// bp, ebp, or esp base registers use SS:
+// Prefix byte classification, used by fetch_prefixes(). The low bits hold
+// the segment register (ix_prefix_seg), the lockrep value (ix_prefix_lock,
+// ix_prefix_rep) or the REX bits (ix_prefix_rex).
+enum
+{
+	ix_prefix_seg = 0x0100,		// 26 2e 36 3e 64 65
+	ix_prefix_66 = 0x0200,
+	ix_prefix_67 = 0x0400,
+	ix_prefix_lock = 0x0800,	// f0
+	ix_prefix_rep = 0x1000,		// f2 f3
+	ix_prefix_rex = 0x2000,		// 40..4f (64 bit mode only)
+	ix_prefix_fwait = 0x4000,	// 9b
+	ix_prefix_legacy = ix_prefix_seg | ix_prefix_66 | ix_prefix_67 | ix_prefix_lock | ix_prefix_rep
+};
 
-	return 1;
+static const U2 prefix_class[256] =
+{
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// 00
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// 10
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0100,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0101,0x0000,	// 20
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0102,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0103,0x0000,	// 30
+	0x2000,0x2001,0x2002,0x2003,0x2004,0x2005,0x2006,0x2007,0x2008,0x2009,0x200a,0x200b,0x200c,0x200d,0x200e,0x200f,	// 40
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// 50
+	0x0000,0x0000,0x0000,0x0000,0x0104,0x0105,0x0200,0x0400,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// 60
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// 70
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// 80
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4000,0x0000,0x0000,0x0000,0x0000,	// 90
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// a0
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// b0
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// c0
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// d0
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,	// e0
+	0x0801,0x0000,0x1002,0x1003,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000	// f0
+};
+
+// With CRUDASM_COMPILED_ARGS defined, get_arguments() calls the generated
+// function for the encoding (see out_intel_decode_funcs.h) instead of working
+// through the encoding's argument types, values and etags at run time.
+#ifdef CRUDASM_COMPILED_ARGS
+typedef int (*decode_args_func_t)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const S1 *sizes);
+#endif
+
+// The decoder proper is in ixdecoder_mode.h, compiled once per mode.
+#define IXDEC_DSZ 0
+#define IXDEC_NAME(x) x##16
+#include "ixdecoder_mode.h"
+#undef IXDEC_DSZ
+#undef IXDEC_NAME
+
+#define IXDEC_DSZ 1
+#define IXDEC_NAME(x) x##32
+#include "ixdecoder_mode.h"
+#undef IXDEC_DSZ
+#undef IXDEC_NAME
+
+#define IXDEC_DSZ 2
+#define IXDEC_NAME(x) x##64
+#include "ixdecoder_mode.h"
+#undef IXDEC_DSZ
+#undef IXDEC_NAME
+
+typedef int (*do_decode_func_t)(struct ix_icode_t *dest, U1 num_bytes, U1 *buf, struct ix_decoder_state_t *state_out);
+typedef int (*fetch_prefixes_func_t)(struct code_fetcher_t *fetcher, struct decode_prefix_state_t *p);
+
+static const do_decode_func_t do_decode_modes[3] = {do_decode16, do_decode32, do_decode64};
+static const fetch_prefixes_func_t fetch_prefixes_modes[3] = {fetch_prefixes16, fetch_prefixes32, fetch_prefixes64};
+
+static void init_icode(struct ix_icode_t *dest, U1 dsz)
+{
+	dest->encoding = 0xffffffff;
+	dest->has_disp = 0;
+	dest->has_imm = 0;
+	dest->lockrep = 0;
+	dest->osz = dsz;
+	dest->asz = dsz;
+	dest->sx = 0;
+	dest->rip_relative = 0;
+	dest->imm64 = 0;
+	dest->argtype[0] = crudasm_intel_argtype_void;
+	dest->argtype[1] = crudasm_intel_argtype_void;
+	dest->argtype[2] = crudasm_intel_argtype_void;
+	dest->argtype[3] = crudasm_intel_argtype_void;
+	dest->ea.base = 31;			// no base reg in ea
+	dest->ea.index = 31;		// no index reg in ea
+	dest->ea.sreg = 7;			// default ds segment
+}
+
+static const char *const status_messages[crudasm_intel_status__count] =
+{
+	"",
+	"tried to decode a 0-byte buffer",
+	"invalid decoder mode",
+	"limit exceeded",
+	"limit exceeded (zero-case)",
+	"limit exceeded (1)",
+	"limit exceeded (2)",
+	"limit exceeded (3)",
+	"limit exceeded (4)",
+	"limit exceeded (4:3)",
+	"limit exceeded (4:4)",
+	"limit exceeded (4:5)",
+	"limit exceeded (4:7)",
+	"limit exceeded (5)",
+	"limit exceeded (6)",
+	"limit exceeded (7)",
+	"limit exceeded (8)",
+	"limit exceeded (9)",
+	"limit exceeded (10)",
+	"invalid opcode",
+	"opcode is invalid in 64bit mode",
+	"invalid opcode: lock used with nonlockable instruction [1]",
+	"invalid opcode: lock used with nonlockable instruction [2]",
+	"invalid opcode: seg reg of 6 or 7 specified",
+	"instruction exceeds 15 bytes",
+	"Unsupported argument encountered",
+	"imm64_sx32 missing from script file",
+	"internal error",
+	"internal table decoder error",
+	"instruction is not fwaitable"
+};
+
+const char *crudasm_intel_status_message(int status)
+{
+	if(status < 0 || status >= crudasm_intel_status__count)
+		return "unknown status";
+	return status_messages[status];
+}
+
+#ifdef CRUDASM_DECODE_STATS
+#ifdef _MSC_VER
+static __declspec(thread) struct crudasm_intel_decode_stats_t decode_stats;
+#else
+static __thread struct crudasm_intel_decode_stats_t decode_stats;
+#endif
+
+static int count_status(int status)
+{
+	++decode_stats.decodes;
+	++decode_stats.failures[status];
+	return status;
+}
+#else
+#define count_status(status) (status)
+#endif
+
+void crudasm_intel_get_decode_stats(struct crudasm_intel_decode_stats_t *stats)
+{
+#ifdef CRUDASM_DECODE_STATS
+	*stats = decode_stats;
+	stats->failures[crudasm_intel_status_ok] = 0;
+#else
+	memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+void crudasm_intel_reset_decode_stats(void)
+{
+#ifdef CRUDASM_DECODE_STATS
+	memset(&decode_stats, 0, sizeof(decode_stats));
+#endif
+}
+
+int crudasm_intel_decode_status(struct ix_icode_t *dest, U8 num_bytes, U1 dsz, U1 *buf, struct ix_decoder_state_t *state_out)
+{
+	struct ix_decoder_state_t state_tmp;
+
+	if(dsz > 2)
+		return count_status(crudasm_intel_status_invalid_mode);
+	if(state_out == NULL)
+		state_out = &state_tmp;
+	
+	init_icode(dest, dsz);
+	
+	// Max 30 bytes to decode: ignored prefixes, FWAIT, prefixes, insn.
+	return count_status(do_decode_modes[dsz](dest, (num_bytes > 30) ? 30 : num_bytes, buf, state_out));
+}
+
+const char *crudasm_intel_decode(struct ix_icode_t *dest, U8 num_bytes, U1 dsz, U1 *buf, struct ix_decoder_state_t *state_out)
+{
+	return status_messages[crudasm_intel_decode_status(dest, num_bytes, dsz, buf, state_out)];
+}
+
+const char *crudasm_intel_decode16(struct ix_icode_t *dest, U8 num_bytes, U1 *buf, struct ix_decoder_state_t *state_out)
+{
+	struct ix_decoder_state_t state_tmp;
+
+	if(state_out == NULL)
+		state_out = &state_tmp;
+	init_icode(dest, 0);
+	return status_messages[count_status(do_decode16(dest, (num_bytes > 30) ? 30 : num_bytes, buf, state_out))];
+}
+
+const char *crudasm_intel_decode32(struct ix_icode_t *dest, U8 num_bytes, U1 *buf, struct ix_decoder_state_t *state_out)
+{
+	struct ix_decoder_state_t state_tmp;
+
+	if(state_out == NULL)
+		state_out = &state_tmp;
+	init_icode(dest, 1);
+	return status_messages[count_status(do_decode32(dest, (num_bytes > 30) ? 30 : num_bytes, buf, state_out))];
 }
 
-// returns 0 on success, -1 on error.
-// *disp_size is size in BYTES on success.
-static int decode_modrm_16(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, U2 dsz, struct decode_prefix_state_t *p, U1 c, int *disp_size, struct ix_decoder_state_t *state)
+const char *crudasm_intel_decode64(struct ix_icode_t *dest, U8 num_bytes, U1 *buf, struct ix_decoder_state_t *state_out)
 {
-	U1 mod = (c >> 6) & 3;
-	U1 rm = c & 7;
-	*disp_size = -1;
+	struct ix_decoder_state_t state_tmp;
 
-	if(rm < 6)
-		dest->ea.index = 6 + (rm & 1);	// [si] [di]
+	if(state_out == NULL)
+		state_out = &state_tmp;
+	init_icode(dest, 2);
+	return status_messages[count_status(do_decode64(dest, (num_bytes > 30) ? 30 : num_bytes, buf, state_out))];
+}
 
-	if(rm < 4)
-		dest->ea.base = 3 + (rm & 2);	// ax cx dx [bx] sp [bp] si di
+size_t crudasm_intel_decode_batch(U1 *buf, U8 len, U1 dsz, struct ix_decode_batch_t *out_soa, size_t max_insns)
+{
+	struct ix_icode_t icode_tmp;
+	struct ix_icode_t *dest;
+	struct ix_decoder_state_t state;
+	int status;
+	U8 offset = 0;
+	U8 left;
+	size_t count = 0;
+	U1 size;
+	do_decode_func_t do_decode;
+
+	if(dsz > 2)
+		max_insns = 0;
 	else
-	if(rm == 6)
+		do_decode = do_decode_modes[dsz];
+
+	while(count < max_insns && offset < len)
 	{
-		if(mod == 0)
-			*disp_size = 2;
+		dest = (out_soa->icodes != NULL) ? out_soa->icodes + count : &icode_tmp;
+		init_icode(dest, dsz);
+		left = len - offset;
+		status = count_status(do_decode(dest, (left > 30) ? 30 : (U1)(left), buf + (size_t)(offset), &state));
+		if(status != crudasm_intel_status_ok)
+		{
+			dest->encoding = 0xffffffff;
+			size = 1;
+		}
 		else
-			dest->ea.base = 5;	// bp
+			size = state.insn_size;
+
+		out_soa->offsets[count] = offset;
+		out_soa->lengths[count] = size;
+		out_soa->encodings[count] = dest->encoding;
+		if(out_soa->status != NULL)
+			out_soa->status[count] = status_messages[status];
+		offset += size;
+		++count;
 	}
-	else
-	if(rm == 7)
+
+	out_soa->count = count;
+	out_soa->next_offset = offset;
+	return count;
+}
+
+//===============================================================================================//
+
+// Stream decoding. An instruction is only decoded once 30 bytes are available
+// (the most crudasm_intel_decode() looks at), or at the end of the stream, so
+// the results never depend on where the chunks were split.
+
+// Decodes the instruction at buf and passes it to the callback. Returns its size.
+static U1 stream_decode_one(struct crudasm_intel_stream_t *stream, U1 *buf, U1 num_bytes)
+{
+	struct ix_icode_t icode;
+	struct ix_decoder_state_t state;
+	int status;
+	U1 size;
+
+	init_icode(&icode, stream->dsz);
+	status = count_status(do_decode_modes[stream->dsz](&icode, num_bytes, buf, &state));
+	if(status != crudasm_intel_status_ok)
 	{
-		dest->ea.base = 3;	// bx
+		icode.encoding = 0xffffffff;
+		size = 1;
 	}
+	else
+		size = state.insn_size;
+	stream->callback(stream->context, stream->offset, buf, size, &icode, &state, status);
+	stream->offset += size;
+	return size;
+}
 
-	if(mod > 0)
-		*disp_size = (mod == 1) ? 1 : 2;
-
-	return 0;
+void crudasm_intel_stream_init(struct crudasm_intel_stream_t *stream, U1 dsz, U8 start_offset, crudasm_intel_stream_callback_t callback, void *context)
+{
+	stream->dsz = (dsz > 2) ? 2 : dsz;
+	stream->carry_size = 0;
+	stream->offset = start_offset;
+	stream->callback = callback;
+	stream->context = context;
 }
 
-// returns 0 on success, -1 on error.
-// *disp_size is size in BYTES on success.
-static int decode_modrm_32(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, U2 dsz, struct decode_prefix_state_t *p, U1 c, int *disp_size, int mode64, struct ix_decoder_state_t *state)
+void crudasm_intel_stream_feed(struct crudasm_intel_stream_t *stream, U1 *buf, size_t len)
 {
-	U1 mod = (c >> 6) & 3;
-	U1 rm = c & 7;
-	U1 ss, i, b;
-	*disp_size = -1;
+	U1 window[30];
+	size_t pos = 0;
+	size_t take;
+	U1 size;
 
-	if(rm == 4)
+	// First finish off any instructions that start in the carried bytes.
+	while(stream->carry_size != 0)
 	{
-		// SIB
-		if(mod == 1)
-			*disp_size = 1;
-		else
-		if(mod == 2)
-			*disp_size = 4;
-		
-		if(!fetch_byte(fetcher, &c))
-			return 1;
-		accept_byte(fetcher);
-
-		ss = (c >> 6) & 3;
-		i = (c >> 3) & 7;
-		b = c & 7;
-	
-		if(i != 4)
+		take = 30 - stream->carry_size;
+		if(take > len)
 		{
-			dest->ea.index = i;
-			dest->ea.index_scale = ss;
+			// Still not enough bytes; keep all of them for next time.
+			memcpy(stream->carry + stream->carry_size, buf, len);
+			stream->carry_size += (U1)(len);
+			return;
 		}
-		else
+		memcpy(window, stream->carry, stream->carry_size);
+		memcpy(window + stream->carry_size, buf, take);
+		size = stream_decode_one(stream, window, 30);
+		if(size >= stream->carry_size)
 		{
-			// index was 4.
-			if(mode64 && p->rex_x)
-			{
-				dest->ea.index = i;
-				dest->ea.index_scale = ss;
-			}
-		}
-	
-		if(b != 5)
-		{
-			dest->ea.base = b;
+			pos = size - stream->carry_size;
+			stream->carry_size = 0;
 		}
 		else
 		{
-			if(mod == 0)
-				*disp_size = 4;
-			else
-				dest->ea.base = 5;
+			stream->carry_size -= size;
+			memmove(stream->carry, stream->carry + size, stream->carry_size);
 		}
 	}
-	else
-	if(rm == 5 && mod == 0)
-		*disp_size = 4;
-	else
-	{
-		dest->ea.base = rm;
-	
-		// bugfix--is this right yet?
-		if(mod == 1)
-			*disp_size = 1;
-		else
-		if(mod == 2)
-			*disp_size = 4;
-	}
 
-	return 0;
+	// Now decode in place, while there are at least 30 bytes.
+	while(len - pos >= 30)
+		pos += stream_decode_one(stream, buf + pos, 30);
+
+	memcpy(stream->carry, buf + pos, len - pos);
+	stream->carry_size = (U1)(len - pos);
 }
 
-// returns 0 on success, -1 on error.
-// *disp_size is size in BYTES on success.
-static int decode_modrm_64(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, U2 dsz, struct decode_prefix_state_t *p, U1 c, int *disp_size, struct ix_decoder_state_t *state)
+void crudasm_intel_stream_finish(struct crudasm_intel_stream_t *stream)
 {
-	int x = decode_modrm_32(fetcher, dest, dsz, p, c, disp_size, 1, state);
-	if(x != 0)
-		return x;
+	U1 size;
 
-	if((c & 0xc7) == 0x05)
+	while(stream->carry_size != 0)
 	{
-		// According to the AMD manual, this is all we have to do here.
-		dest->rip_relative = 1;
+		size = stream_decode_one(stream, stream->carry, stream->carry_size);
+		stream->carry_size -= size;
+		memmove(stream->carry, stream->carry + size, stream->carry_size);
 	}
-	else
-	{
-		if(dest->ea.base != 31)
-			dest->ea.base += (p->rex_b << 3);
-		if(dest->ea.index != 31)
-			dest->ea.index += (p->rex_x << 3);
-	}
-
-	return 0;
 }
 
-S1 intel_specialize_arg_size(S1 size, U1 dsz, U1 osz, U1 asz)
+//===============================================================================================//
+
+// Superset decoding. Offsets are done from the end of the region backwards, so
+// the result for the next offset is known when we get to a prefix byte. If that
+// prefix byte doesn't change the prefix state, the instruction is the one at the
+// next offset, one byte longer. The only things that can differ are the size
+// limits: 15 bytes unless an FWAIT was used, and the 30 byte decode window,
+// which is why the window has to reach at least 16 bytes past the opcode (no
+// encoding is longer than that, counting from the opcode).
+
+static int same_prefix_state(const struct decode_prefix_state_t *a, const struct decode_prefix_state_t *b)
 {
-	if(size >= 0)
-		return size;
-	switch(size)
-	{
-	case crudasm_intel_argsize_size_osz:
-		return 2 << osz;
-	case crudasm_intel_argsize_size_asz:
-		return 2 << asz;
-	case crudasm_intel_argsize_size_osz_ptr:
-		return (dsz == 2) ? 8 : 4;
-	case crudasm_intel_argsize_size_osz_max32:
-		return (osz == 2) ? 4 : (2 << osz);
-	case crudasm_intel_argsize_size_osz_min32:
-		return (osz == 0) ? 4 : (2 << osz);
-	case crudasm_intel_argsize_size_osz_min64:
-		return (osz == 2) ? 16 : 8;
-	case crudasm_intel_argsize_size_osz_seg:
-		return (osz == 2) ? 8 : 2;
-	case crudasm_intel_argsize_size_osz_64in64:
-		if(dsz == 2)
-			return 8;
-		return 2 << osz;
-	default:
-		break;
-	}
-	return 0;	// unsupported size !
+	return a->lockrep == b->lockrep && a->op66 == b->op66 && a->op67 == b->op67 &&
+		a->rex_w == b->rex_w && a->rex_r == b->rex_r && a->rex_x == b->rex_x && a->rex_b == b->rex_b &&
+		a->sreg == b->sreg && a->rex_used == b->rex_used && a->wait_used == b->wait_used;
 }
 
-// Returns NULL on success, else an error message.
-const char *get_arguments(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, U1 dsz, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, struct crudasm_intel_encoding_t *encoding, struct crudasm_intel_insn_t *insn)
+size_t crudasm_intel_decode_superset(U1 *buf, U8 len, U1 dsz, U8 begin, U8 end, struct ix_superset_t *out)
 {
-	int i, j, disp_size, disp_size_2, k;
-	U1 type, rm_reg_shift, rm_rex_reg, c, immvalue, valbase;
-	U8 disp, value;
-	int imm2nd;
-	U4 *imm_out;
-	S2 size;
-	
-	for(i = 0; i < 4; ++i)
-	{
-		dest->argtype[i] = encoding->argtype[i];
-		dest->argsize[i] = encoding->argsize[i];
-		dest->argvalue[i] = encoding->argvalue[i];
-	}
+	struct ix_icode_t icode;
+	struct ix_decoder_state_t state;
+	struct code_fetcher_t fetcher;
+	struct decode_prefix_state_t p, next_p;
+	size_t opcode_offset = 0, next_opcode_offset = 0;
+	int fetched, have_next = 0;
+	int status, next_status = crudasm_intel_status_ok;
+	U1 size, next_size = 0;
+	U4 encoding, next_encoding = 0xffffffff;
+	U1 window;
+	U8 offset;
+	size_t decoded = 0;
+	do_decode_func_t do_decode;
+	fetch_prefixes_func_t fetch_prefixes;
+
+	if(dsz > 2)
+		return 0;
+	do_decode = do_decode_modes[dsz];
+	fetch_prefixes = fetch_prefixes_modes[dsz];
+	if(end > len)
+		end = len;
 
-	for(i = 0; i < 4; ++i)
+	for(offset = end; offset > begin; )
 	{
-		type = dest->argtype[i];
-		if(type == crudasm_intel_argtype_void)
-			break;
-		rm_reg_shift = 3;
-		rm_rex_reg = p->rex_r;
+		--offset;
+		window = (len - offset > 30) ? 30 : (U1)(len - offset);
 
-		dest->argsize[i] = intel_specialize_arg_size(dest->argsize[i], dsz, dest->osz, dest->asz);
-		if(dest->argsize[i] <= 0)
-			return "Unsupported argument encountered";
-
-		if(dest->argvalue[i] == crudasm_intel_argvalue_reg_or_mem)
+		// We only need the prefix state here if this byte or the one before it is a prefix.
+		fetched = 0;
+		if((prefix_class[buf[(size_t)(offset)]] & ix_prefix_legacy) ||
+			(offset > begin && (prefix_class[buf[(size_t)(offset) - 1]] & ix_prefix_legacy)))
 		{
-			// Argument is reg/mem, where reg is any kind of register.
-			//type &= 0x7f;
-			rm_reg_shift = 0;
-			rm_rex_reg = p->rex_b;
-			if(state->modrm0 < 0xc0)
-				type = dest->argtype[i] = crudasm_intel_argtype_mem_ea;
-			dest->argvalue[i] = crudasm_intel_argvalue_default;
+			fetcher.buf = buf + (size_t)(offset);
+			fetcher.bytes_left = window;
+			fetcher.next_offset = 0;
+			fetched = fetch_prefixes(&fetcher, &p);
+			opcode_offset = (size_t)(offset) + fetcher.next_offset;
 		}
 
-		if(type == crudasm_intel_argtype_mem_fulldisp)
+		if(fetched && have_next && (prefix_class[buf[(size_t)(offset)]] & ix_prefix_legacy) &&
+			opcode_offset == next_opcode_offset && same_prefix_state(&p, &next_p) &&
+			(fetcher.next_offset + 16 <= window || len - offset <= 30))
 		{
-			dest->has_disp = 1;
-			state->disp_offset = (U1)(fetcher->next_offset);
-			disp_size_2 = 2 << dest->asz;
-			disp = 0;
-			for(j = 0; j < disp_size_2; ++j)
+			status = next_status;
+			size = 0;
+			encoding = 0xffffffff;
+			if(status == crudasm_intel_status_ok)
 			{
-				if(!fetch_byte(fetcher, &c))
-					return "limit exceeded (7)";
-				accept_byte(fetcher);
-				///disp = (disp << 8) | static_cast<U8>(c);
-				disp |= SHL64((U8)(c), 8 * j);
-			}
-			dest->disp = (U4)(disp);
-			if(disp_size_2 == 8)
-				dest->imm = (U4)((disp >> 16) >> 16);
-		}
-		else
-		if(crudasm_intel_argtype__is_imm(type))
-		{
-			imm2nd = (type == crudasm_intel_argtype_imm_2nd);
-			imm_out = (imm2nd) ? &dest->disp : &dest->imm;
-
-			if(type == crudasm_intel_argtype_imm_implict)
-			{
-				*imm_out = dest->argvalue[i];	// zero extend the implict value given
-			}
-			else
-			{
-				// imm1_offset, imm2_offset apply only to non-implict immediates.
-				if(imm2nd)
-					state->imm2_offset = (U1)(fetcher->next_offset);
-				else
-					state->imm1_offset = (U1)(fetcher->next_offset);
-
-				// Need to fetch this immediate.
-				if(encoding->etags & crudasm_intel_etag_sx_byte)
-				{
-					if(dest->argsize[i] == 1)
-						return "internal error";	// sx_byte should not be used with byte-sized immediates
-					dest->sx = 1;
-
-					if(!fetch_byte(fetcher, &immvalue))
-						return "limit exceeded (8)";
-					accept_byte(fetcher);
-					
-					if(dest->osz == 0)
-						*imm_out = (U4)(U2)(S2)(S1)(immvalue);
-					else
-					{
-						// Note: if imm arg's size is 64 bits, then one has to sign extend
-						// s.icode->imm to 64 bits if 'ixflag_imm64_sx32' is used. Otherwise,
-						// 'ixflag_imm64_disp' should be used, meaning the immediate was
-						// actually encoded as a 64bit value--in which case s.icode->disp
-						// holds the upper 32 bits of the immediate. This never happens when
-						// 'ixflag_sx_byte' is used, however.
-						*imm_out = (U4)(S4)(S1)(immvalue);
-					}
-				}	// sx_byte
+				if(next_size >= 15 && !p.wait_used)
+					status = crudasm_intel_status_too_long;
 				else
-				if(dest->argsize[i] == 8 && (encoding->etags & crudasm_intel_etag_imm64_disp))
 				{
-					// Fetch 64 bits.
-					value = 0;
-					for(k = 0; k < 8; ++k)
-					{
-						if(!fetch_byte(fetcher, &c))
-							return "limit exceeded (9)";
-						accept_byte(fetcher);
-						//value = (value << 8) | static_cast<U8>(c);
-						value |= SHL64((U8)(c), 8 * k);
-					}
-					dest->imm = (U4)(value);
-					dest->disp = (U4)((value >> 16) >> 16);
-					dest->imm64 = 1;
-				}
-				else
-				{
-					size = dest->argsize[i];
-					if(size == 8)
-					{
-						if(!(encoding->etags & crudasm_intel_etag_imm64_sx32))
-							return "imm64_sx32 missing from script file";
-						size = 4;
-					}
-					// Fetch 'size' bytes.
-					value = 0;
-					for(k = 0; k < size; ++k)
-					{
-						if(!fetch_byte(fetcher, &c))
-							return "limit exceeded (10)";
-						accept_byte(fetcher);
-						//value = (value << 8) | static_cast<U4>(c);
-						value |= SHL64((U8)(c), 8 * k);
-					}
-					*imm_out = value;
+					size = next_size + 1;
+					encoding = next_encoding;
 				}
 			}
 		}
 		else
-		if(crudasm_intel_argtype__is_reg(type))
 		{
-			if(dest->argvalue[i] == crudasm_intel_argvalue_default)
-			{
-				if(type == crudasm_intel_argtype_reg_gr)
-				{
-					U1 value = dest->argvalue[i];
-					if(encoding->etags & crudasm_intel_etag_reg_base)
-					{
-						value = state->opcode0 & 7;
-						value += (U1)(p->rex_b) << 3;
-					}
-					else
-					if(encoding->etags & crudasm_intel_etag_reg_rm)
-					{
-						// Is this right ?
-						value = (state->modrm0 & 7) + ((U1)(p->rex_b) << 3);
-					}
-					else
-					{
-						value = (state->modrm0 >> rm_reg_shift) & 7;
-						value += rm_rex_reg << 3;
-					}
-					dest->argvalue[i] = value;
-				}
-				else
-				if(type == crudasm_intel_argtype_reg_sr)
-				{
-					dest->argvalue[i] = (state->modrm0 >> 3) & 7;
-					if(dest->argvalue[i] > 5)
-						return "invalid opcode: seg reg of 6 or 7 specified";
-				}
-				else
-				{
-					valbase = ((state->modrm0 >> rm_reg_shift) & 7);
-					if(encoding->etags & crudasm_intel_etag_reg_base)
-						valbase = state->opcode0 & 7;
-					else
-					if(encoding->etags & crudasm_intel_etag_reg_rm)
-						valbase = (state->modrm0 & 7) + ((U1)(p->rex_b) << 3);
-					else
-						valbase += (rm_rex_reg << 3);
-					dest->argvalue[i] = valbase;
-				}
-			}
+			init_icode(&icode, dsz);
+			status = count_status(do_decode(&icode, window, buf + (size_t)(offset), &state));
+			size = (status == crudasm_intel_status_ok) ? state.insn_size : 0;
+			encoding = (status == crudasm_intel_status_ok) ? icode.encoding : 0xffffffff;
+			++decoded;
 		}
+
+		have_next = fetched;
+		next_p = p;
+		next_opcode_offset = opcode_offset;
+		next_status = status;
+		next_size = size;
+		next_encoding = encoding;
+
+		if(out->lengths != NULL)
+			out->lengths[(size_t)(offset)] = size;
+		if(out->status != NULL)
+			out->status[(size_t)(offset)] = (U1)(status);
+		if(out->encodings != NULL)
+			out->encodings[(size_t)(offset)] = encoding;
 	}
 
-	return NULL;
+	return decoded;
 }
 
-const char *try_decode(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, U1 dsz, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state)
+void crudasm_intel_superset_preds(const U1 *lengths, U8 len, U4 *first, U4 *preds)
 {
-	U1 c;
-	int got_modrm = 0;
-	U4 decoder_table_root;
-	size_t offset;
-	U1 type;
-	U4 *decoder_table;
-	int done;
-	size_t op66, lockrep;
-	struct crudasm_intel_encoding_t *encoding;
-	struct crudasm_intel_insn_t *insn;
-	int is64;
-	const char *msg;
-
-	state->prefix_size = fetcher->next_offset;
-	state->rex_used = p->rex_used;
-	state->wait_used = p->wait_used;
-	state->has_modrm = 0;
-	state->disp_offset = 255;
-	state->imm1_offset = 255;
-	state->imm2_offset = 255;
-	state->modrm_offset = 255;
-	
-	if(fetcher->bytes_left == 0)
-		return "limit exceeded (zero-case)";
+	U8 i, next;
 
-	if(!fetch_byte(fetcher, &c))
-		return "limit exceeded (1)";
-	state->opcode0 = c;
-	state->modrm0 = 0;	// normalize value
+	// Count the predecessors of each offset, and turn the counts into start positions.
+	memset(first, 0, (size_t)(len + 1) * sizeof(U4));
+	for(i = 0; i < len; ++i)
+	{
+		next = i + lengths[(size_t)(i)];
+		if(lengths[(size_t)(i)] != 0 && next < len)
+			++first[(size_t)(next) + 1];
+	}
+	for(i = 0; i < len; ++i)
+		first[(size_t)(i) + 1] += first[(size_t)(i)];
 
-	if(state->opcode0 == 0x0f)
+	// Fill in each list, using first[j] as the fill position for offset j. That
+	// leaves first[j] where j's list ends, i.e. where the list for j + 1 starts.
+	for(i = 0; i < len; ++i)
 	{
-		if(fetcher->bytes_left < 2)
-			return "limit exceeded (2)";
-		state->opcode0 = fetcher->buf[fetcher->next_offset + 1];
-		state->opcode0 += 0x100;
+		next = i + lengths[(size_t)(i)];
+		if(lengths[(size_t)(i)] != 0 && next < len)
+			preds[first[(size_t)(next)]++] = (U4)(i);
 	}
+	for(i = len; i > 0; --i)
+		first[(size_t)(i)] = first[(size_t)(i) - 1];
+	first[0] = 0;
+}
 
-	decoder_table_root = crudasm_intel_decoder_table[0];
-	offset = decoder_table_root & 0xffffff;
-	type = decoder_table_root >> 24;
+//===============================================================================================//
 
-	// Before we begin, make dest->asz valid.
-	if(dsz == 0)
+// Decode cache. A successful decode that doesn't involve an FWAIT looks at
+// nothing but the instruction's own bytes, so whenever the bytes stored in an
+// entry are at buf, in the same mode, the stored results are the answer. The
+// prefix we hash may run past a short instruction into the next one; that
+// costs a miss now and then, never a wrong answer.
+
+void crudasm_intel_decode_cache_init(struct crudasm_intel_decode_cache_t *cache)
+{
+	memset(cache->entries, 0, sizeof(cache->entries));
+	cache->lookups = 0;
+	cache->hits = 0;
+	cache->uncacheable = 0;
+}
+
+int crudasm_intel_decode_cached(struct crudasm_intel_decode_cache_t *cache, struct ix_icode_t *dest, U8 num_bytes, U1 dsz, U1 *buf, struct ix_decoder_state_t *state_out)
+{
+	struct ix_decoder_state_t state_tmp;
+	struct crudasm_intel_decode_cache_entry_t *entry;
+	U8 prefix = 0;
+	U1 i;
+	U1 size;
+	int status;
+
+	if(dsz > 2)
+		return count_status(crudasm_intel_status_invalid_mode);
+	if(state_out == NULL)
+		state_out = &state_tmp;
+	++cache->lookups;
+
+	if(num_bytes >= CRUDASM_DECODE_CACHE_PREFIX)
 	{
-		dest->asz = (p->op67) ? 1 : 0;
+		for(i = 0; i < CRUDASM_DECODE_CACHE_PREFIX; ++i)
+			prefix |= (U8)(buf[i]) << (8 * i);
 	}
 	else
-	if(dsz == 1)
 	{
-		dest->asz = (p->op67) ? 0 : 1;
+		for(i = 0; i < num_bytes; ++i)
+			prefix |= (U8)(buf[i]) << (8 * i);
 	}
-	else
+	entry = cache->entries + (size_t)((prefix * 0x9e3779b97f4a7c15ULL + dsz * 0xc2b2ae3d27d4eb4fULL) >> (64 - CRUDASM_DECODE_CACHE_BITS));
+
+	size = entry->key[0] & 15;
+	if((entry->key[0] >> 4) == dsz && size != 0 && size <= num_bytes && memcmp(entry->key + 1, buf, size) == 0)
 	{
-		// 64 bit mode.
-		dest->asz = (p->op67) ? 1 : 2;
+		++cache->hits;
+		*dest = entry->icode;
+		*state_out = entry->state;
+		return count_status(crudasm_intel_status_ok);
 	}
 
-	dest->lockrep = p->lockrep;
-	dest->ea.sreg = p->sreg;
-	dest->rip_relative = 0;
-	dest->ea.index_scale = 0;
-	dest->ea.disp8 = 0;
-	dest->is_nop = (state->opcode0 == 0x90) ? 1 : 0;
-	dest->rex_used = state->rex_used;
+	init_icode(dest, dsz);
+	status = count_status(do_decode_modes[dsz](dest, (num_bytes > 30) ? 30 : (U1)(num_bytes), buf, state_out));
+	if(status != crudasm_intel_status_ok || state_out->wait_used || state_out->opcode0 == 0x9b || state_out->insn_size > 15)
+	{
+		++cache->uncacheable;
+		return status;
+	}
+
+	entry->key[0] = (U1)((dsz << 4) | state_out->insn_size);
+	memcpy(entry->key + 1, buf, state_out->insn_size);
+	entry->icode = *dest;
+	entry->state = *state_out;
+	return status;
+}
 
-	decoder_table = crudasm_intel_decoder_table + 1;
+// Length-only decoding. This follows try_decode() and get_modrm(), but it
+// only keeps track of where the instruction ends. Everything it needs to know
+// about an encoding is in crudasm_intel_length_table[].
 
-	done = 0;
-	do
+// Skips over modr/m, sib, and displacement bytes. Returns 0 if out of bytes.
+static int skip_modrm(struct code_fetcher_t *fetcher, U1 dsz, U1 asz, U1 *modrm0)
+{
+	U1 c, disp_size;
+	const struct modrm_desc_t *m;
+
+	if(!fetch_byte(fetcher, &c))
+		return 0;
+	accept_byte(fetcher);
+	*modrm0 = c;
+
+	m = ((dsz != 2 && asz == 0) ? modrm_desc_16 : modrm_desc_32) + (((c >> 3) & 0x18) | (c & 7));
+	disp_size = m->disp_size;
+	if(m->sib_row != 0)
+	{
+		if(!fetch_byte(fetcher, &c))
+			return 0;
+		accept_byte(fetcher);
+		disp_size += sib_desc[m->sib_row - 1][c].disp_size;
+	}
+
+	if(fetcher->bytes_left < disp_size)
+		return 0;
+	fetcher->bytes_left -= disp_size;
+	fetcher->next_offset += disp_size;
+	return 1;
+}
+
+static U1 finish_length(struct code_fetcher_t *fetcher, U1 dsz, U1 asz, struct decode_prefix_state_t *p, U4 info, int got_modrm, U1 modrm0, U4 *length_info);
+
+// Returns the instruction size (counting from the start of the buffer), or 0
+// if try_decode() would fail. *length_info gets the crudasm_intel_length_table[]
+// entry for the encoding, if we got that far. If encoding isn't NULL, it gets
+// the encoding index; that means walking the decoder table even for opcodes
+// where crudasm_intel_length_opcode_table[] alone would do.
+static U1 try_length(struct code_fetcher_t *fetcher, U1 dsz, struct decode_prefix_state_t *p, U4 *length_info, U4 *encoding)
+{
+	U1 c;
+	U1 modrm0 = 0;
+	int got_modrm = 0;
+	U4 info;
+	U2 entry;
+	size_t offset, index;
+	U1 type, asz;
+	const U2 *decoder_table;
+
+	*length_info = 0;
+
+	if(!fetch_byte(fetcher, &c))
+		return 0;
+	if(c == 0x0f && fetcher->bytes_left < 2)
+		return 0;
+
+	if(dsz == 0)
+		asz = (p->op67) ? 1 : 0;
+	else
+	if(dsz == 1)
+		asz = (p->op67) ? 0 : 1;
+	else
+		asz = (p->op67) ? 1 : 2;
+
+	// Most opcodes tell us all we need to know, without walking the decoder table.
+	if(c != 0x0f)
+		info = crudasm_intel_length_opcode_table[c];
+	else
+		info = crudasm_intel_length_opcode_table[0x100 + fetcher->buf[fetcher->next_offset + 1]];
+	if(!(info & crudasm_intel_length_tree) && encoding == NULL)
+	{
+		if(c == 0x0f)
+			accept_byte(fetcher);
+		accept_byte(fetcher);
+		return finish_length(fetcher, dsz, asz, p, info, 0, 0, length_info);
+	}
+
+	index = (c != 0x0f) ? c : 0x100 + fetcher->buf[fetcher->next_offset + 1];
+	if(c == 0x0f)
+		accept_byte(fetcher);
+	accept_byte(fetcher);
+	index += (p->op66) ? 0x200 : 0;
+	if(p->lockrep == 2)
+		index += 0x400;
+	else
+	if(p->lockrep == 3)
+		index += 0x800;
+	entry = crudasm_intel_decoder_flat_table[index];
+	offset = entry & crudasm_intel_decoder_offset;
+	type = entry >> crudasm_intel_decoder_type_shift;
+	decoder_table = crudasm_intel_decoder_table;
+
+	while(type != 0)
 	{
 		switch(type)
 		{
-		case 0:
-		{
-			state->encoding_index = (U4)(offset);
-			if(state->encoding_index == 0xffffff)
-				return "invalid opcode";
-			done = 1;
-			break;
-		}
 		case 1:
-		{
 			if(!fetch_byte(fetcher, &c))
-				return "limit exceeded (3)";
-			offset += (size_t)(c);
-			type = decoder_table[offset] >> 24;
-			offset = decoder_table[offset] & 0xffffff;
+				return 0;
 			accept_byte(fetcher);
+			offset += (size_t)(c >> 4);
 			break;
-		}
-		case 6:
-		{
-			if(dsz == 2)
-				++offset;
-			type = decoder_table[offset] >> 24;
-			offset = decoder_table[offset] & 0xffffff;
+		case 8:
+			offset += (size_t)(c & 0xf);
 			break;
-		}
 		case 2:
-		{
-			op66 = (p->op66) ? 1 : 0;
-			lockrep = 0;
+			offset += (p->op66) ? 1 : 0;
 			if(p->lockrep == 2)
-				lockrep = 1;
+				offset += 2;
 			else
 			if(p->lockrep == 3)
-				lockrep = 2;
-			offset += op66 + 2 * lockrep;
-			type = decoder_table[offset] >> 24;
-			offset = decoder_table[offset] & 0xffffff;
+				offset += 4;
 			break;
-		}
 		case 3:
 		case 4:
 		case 5:
 		case 7:
-		{
 			if(!got_modrm)
 			{
 				got_modrm = 1;
-				if(!get_modrm(fetcher, dest, dsz, p, state))
-				{
-					if(type == 3)
-						return "limit exceeded (4:3)";
-					if(type == 4)
-						return "limit exceeded (4:4)";
-					if(type == 5)
-						return "limit exceeded (4:5)";
-					if(type == 7)
-						return "limit exceeded (4:7)";
-					return "limit exceeded (4)";
-				}
+				if(!skip_modrm(fetcher, dsz, asz, &modrm0))
+					return 0;
 			}
 			if(type == 3)
-				offset += (size_t)(state->modrm0 >> 3);
+				offset += (size_t)(modrm0 >> 3);
 			else
 			if(type == 4)
-				offset += (size_t)((state->modrm0 >> 3) & 7);
+				offset += (size_t)((modrm0 >> 3) & 7);
 			else
 			if(type == 5)
-				offset += (size_t)(state->modrm0 & 7);
+				offset += (size_t)(modrm0 & 7);
 			else
 			{
 				if(!fetch_byte(fetcher, &c))
-					return "limit exceeded (5)";
+					return 0;
 				accept_byte(fetcher);
 				offset += (size_t)(c);
 			}
-			type = decoder_table[offset] >> 24;
-			offset = decoder_table[offset] & 0xffffff;
 			break;
-		}
+		case 6:
+			if(dsz == 2)
+				++offset;
+			break;
 		default:
-			return "internal table decoder error";
+			return 0;	// internal table decoder error
 		}
-	}	while(!done);
-	
-	encoding = crudasm_intel_encoding_table + state->encoding_index;
-	insn = crudasm_intel_insns + encoding->insn;
-	///dest->insn = (U4)(encoding->insn);
-	dest->encoding = state->encoding_index;
-	
-	///printf("Instruction = [%s]\n", insn->name);
+		type = decoder_table[offset] >> crudasm_intel_decoder_type_shift;
+		offset = decoder_table[offset] & crudasm_intel_decoder_offset;
+	}
 
-	if(dsz == 2 && (encoding->etags & crudasm_intel_etag_no64))
-		return "opcode is invalid in 64bit mode";
+	if(offset == crudasm_intel_decoder_invalid)
+		return 0;	// invalid opcode
 
-	if(!got_modrm && encoding->regop != 0xf)
-	{
-		got_modrm = 1;
-		if(!get_modrm(fetcher, dest, dsz, p, state))
-			return "limit exceeded (6)";
-	}
-	
-	if(dsz == 0)
+	if(encoding != NULL)
+		*encoding = (U4)(offset);
+	return finish_length(fetcher, dsz, asz, p, crudasm_intel_length_table[offset], got_modrm, modrm0, length_info);
+}
+
+// Returns the number of immediate bytes for a crudasm_intel_length_table[]
+// entry (0xf if invalid), not counting any full-size displacement.
+static U4 length_imm_size(U4 info, U1 dsz, struct decode_prefix_state_t *p)
+{
+	U1 imm_index;
+
+	if(dsz == 2)
+		imm_index = 2 + p->op66 + 2 * p->rex_w;
+	else
+		imm_index = (p->op66) ? (dsz ^ 1) : dsz;
+	return (info >> (4 * imm_index)) & 0xf;
+}
+
+// This does the rest of try_length(), once we know the encoding.
+static U1 finish_length(struct code_fetcher_t *fetcher, U1 dsz, U1 asz, struct decode_prefix_state_t *p, U4 info, int got_modrm, U1 modrm0, U4 *length_info)
+{
+	U4 imm;
+
+	*length_info = info;
+
+	if(dsz == 2 && (info & crudasm_intel_length_no64))
+		return 0;
+
+	if(!got_modrm && (info & crudasm_intel_length_modrm))
 	{
-		dest->osz = (p->op66) ? 1 : 0;
+		if(!skip_modrm(fetcher, dsz, asz, &modrm0))
+			return 0;
 	}
-	else
-	if(dsz == 1)
+
+	imm = length_imm_size(info, dsz, p);
+	if(imm == 0xf)
+		return 0;
+	if(info & crudasm_intel_length_fulldisp)
+		imm += 2 << asz;
+	if(fetcher->bytes_left < imm)
+		return 0;
+	fetcher->bytes_left -= imm;
+	fetcher->next_offset += imm;
+
+	if((info & crudasm_intel_length_sreg) && ((modrm0 >> 3) & 7) > 5)
+		return 0;
+
+	if(p->lockrep == 1)
 	{
-		dest->osz = (p->op66) ? 0 : 1;
+		if(!(info & crudasm_intel_length_lock_mem) && !((info & crudasm_intel_length_lock_rm) && modrm0 < 0xc0))
+			return 0;
 	}
-	else
+
+	return (U1)(fetcher->next_offset);
+}
+
+// Does the work of crudasm_intel_insn_length(). *p gets the prefixes the
+// instruction ended up with, and *info its crudasm_intel_length_table[] entry.
+// If encoding isn't NULL, it gets the encoding index.
+static U1 length_decode(U8 num_bytes, U1 dsz, U1 *buf, struct decode_prefix_state_t *p, U4 *info, U4 *encoding)
+{
+	struct code_fetcher_t fetcher;
+	U1 size, c;
+	int rex;
+
+	fetcher.buf = buf;
+	fetcher.bytes_left = (num_bytes > 30) ? 30 : (U1)(num_bytes);
+	fetcher.next_offset = 0;
+
+	// Most instructions don't start with a prefix or FWAIT, except maybe REX.
+	// Those don't need fetch_prefixes().
+	c = buf[0];
+	rex = (dsz == 2 && (c & 0xf0) == 0x40);
+	if(!(prefix_class[c] & (ix_prefix_legacy | ix_prefix_fwait)) && !(rex && fetcher.bytes_left >= 2 && buf[1] == 0x9b))
 	{
-		dest->osz = (p->op66) ? 0 : 1;
-		if(!(encoding->etags & crudasm_intel_etag_no_rex_w))
+		reset_prefix(p);
+		if(rex)
 		{
-			is64 = ((encoding->etags & crudasm_intel_etag_is64) != 0);
-			if(p->rex_w != 0 || is64)
-			{
-				// Note: 0x66 is ignored if used with rex.w (AMD manual).
-				// However, if it's is64 and 66 is used WITHOUT a rex.w,
-				// make osz 16 bits.
-				dest->osz = 2;
-				if(p->op66 && is64 && p->rex_w == 0)
-					dest->osz = 0;
-			}
+			p->rex_used = 1;
+			p->rex_w = (c >> 3) & 1;
+			accept_byte(&fetcher);
 		}
+		size = try_length(&fetcher, dsz, p, info, encoding);
+		return (size > 15) ? 0 : size;
 	}
 
-	// Process arguments.
-	dest->has_imm = 0;		// redundant
-	dest->imm64 = 0;
-	dest->sx = 0;
+	if(!fetch_prefixes_modes[dsz](&fetcher, p))
+		return 0;
 
-	msg = get_arguments(fetcher, dest, dsz, p, state, encoding, insn);
-	if(msg != NULL)
-		return msg;
+	// The FWAIT rules are the same as in do_decode().
+	size = try_length(&fetcher, dsz, p, info, encoding);
 
-	// Check for bad LOCK usage.
-	if(dest->lockrep == 1)
+	if(p->wait_used)
 	{
-		if(!(insn->itags & crudasm_intel_itag_lockable) && !(insn->itags & crudasm_intel_itag_lock_always))
+		if(size == 0 || !(*info & crudasm_intel_length_fwaitable))
 		{
-			return "invalid opcode: lock used with nonlockable instruction [1]";
-		}
-		// ok, instruction is lockable (or is always locked).
-		///U1 first_argtype_major = encoding->argtype[0] & 0xe0;
-		if(!crudasm_intel_argtype__is_mem(dest->argtype[0]))
-		{
-			return "invalid opcode: lock used with nonlockable instruction [2]";
+			// match wait, itself. discard any prefixes.
+			reset_prefix(p);
+			*info = 0;
+			if(encoding != NULL)
+				*encoding = crudasm_intel_decoder_flat_table[0x9b] & crudasm_intel_decoder_offset;
+			return (U1)(p->wait_offset + 1);
 		}
-		// if here, lock was used and IS allowed.
-		// note that the 1st argument of xchg must be a memory argument in
-		// the script in order for lock to be usable with it.
+		return size;
 	}
 
-	state->insn_size = (U1)(fetcher->next_offset);
-	return "";	// success
+	if(size > 15)
+		return 0;
+	return size;
 }
 
-const char *do_decode(struct ix_icode_t *dest, U1 num_bytes, U1 dsz, U1 *buf, struct ix_decoder_state_t *state_out)
+U1 crudasm_intel_insn_length(U8 num_bytes, U1 dsz, U1 *buf)
 {
-	const char *status = "internal error";
-	struct code_fetcher_t fetcher;
-	struct code_fetcher_t fetcher_copy;
 	struct decode_prefix_state_t p;
-	U1 c;
-	U1 got_fwait = 0;
-	
-	if(num_bytes == 0)
-		return "tried to decode a 0-byte buffer";
-	
-	fetcher.buf = buf;
-	fetcher.bytes_left = num_bytes;
-	fetcher.next_offset = 0;
-	
-	for(;;)
-	{
-		// If we use FWAIT, relevant prefixes go after the FWAIT, i.e. any
-		// prefixes before the FWAIT are ignored.
-		reset_prefix(&p);
+	U4 info;
 
-		// Fetch standard x86 prefixes.
-		for(;;)
-		{
-			if(!fetch_byte(&fetcher, &c))
-			{
-				if(got_fwait)
-				{
-					//++fetcher.bytes_left;
-					//--fetcher.next_offset;
-					reset_prefix(&p);	// for consistency, drop all prefixes from fwait
-					// note that p.wait_used is undefined if the insn itself is fwait!
-					break;
-				}
-				return "limit exceeded";
-			}
+	if(num_bytes == 0 || dsz > 2)
+		return 0;
+	return length_decode(num_bytes, dsz, buf, &p, &info, NULL);
+}
 
-			// 001ss110
-			if((c & 0xe7) == 0x26)
-				p.sreg = ((c >> 3) & 3);
-			else
-			// 011001xx
-			if((c & 0xfc) == 0x64)
-			{
-				if(c < 0x66)
-					p.sreg = (c & 7);
-				else
-				if(c == 0x66)
-					p.op66 = 1;
-				else
-				// 0x67
-					p.op67 = 1;
-			}
-			else
-			// 111100xx
-			if((c & 0xfc) == 0xf0)
-			{
-				if(c == 0xf0)
-					p.lockrep = 1;
-				else
-				if(c == 0xf1)
-					break;
-				else
-				{
-					// 0xf2 or 0xf3
-					// 0xf0 overrides 0xf2, 0xf3.
-					if(p.lockrep == 0)
-						p.lockrep = (c & 3);
-				}
-			}
-			else
-				break;
-		
-			accept_byte(&fetcher);
-		}
+U1 crudasm_intel_decode_control(struct ix_control_info_t *dest, U8 num_bytes, U1 dsz, U1 *buf, U8 address)
+{
+	struct decode_prefix_state_t p;
+	U4 info, encoding, imm, i;
+	U8 rel;
+	U1 size;
 
-		// now if in 64-bit mode, get any REX prefix.
-		if(dsz == 2 && fetch_byte(&fetcher, &c))
-		{
-			if((c & 0xf0) == 0x40)
-			{
-				p.rex_used = 1;
-	
-				p.rex_w = (c >> 3) & 1;
-				p.rex_r = (c >> 2) & 1;
-				p.rex_x = (c >> 1) & 1;
-				p.rex_b = (c >> 0) & 1;
-	
-				// byte was accepted.
-				accept_byte(&fetcher);
-			}
-		}
+	dest->encoding = 0xffffffff;
+	dest->size = 0;
+	dest->control = crudasm_intel_control_none;
+	dest->target = 0;
 
-		if(fetch_byte(&fetcher, &c) && !got_fwait)
+	if(num_bytes == 0 || dsz > 2)
+		return 0;
+	size = length_decode(num_bytes, dsz, buf, &p, &info, &encoding);
+	if(size == 0)
+		return 0;
+
+	dest->encoding = encoding;
+	dest->size = size;
+	dest->control = crudasm_intel_control_table[encoding];
+
+	if(dest->control & crudasm_intel_control_relative)
+	{
+		// The displacement is the last thing in the instruction: rel8, rel16
+		// or rel32, sign extended.
+		if(dest->control & crudasm_intel_control_rel8)
+			imm = 1;
+		else
+			imm = (dsz == 2 || ((p.op66) ? (dsz ^ 1) : dsz) != 0) ? 4 : 2;
+		rel = 0;
+		for(i = imm; i > 0; --i)
+			rel = (rel << 8) | buf[size - imm + i - 1];
+		if(imm != 0 && imm < 8)
+			rel = (U8)((S8)(rel << (64 - 8 * imm)) >> (64 - 8 * imm));
+		dest->target = address + size + rel;
+		if(dsz != 2)
 		{
-			if(c == 0x9b)
-			{
-				got_fwait = 1;
-				accept_byte(&fetcher);
-				continue;
-			}
+			// Same as the disassembler: wrap around to the operand size.
+			if(((p.op66) ? (dsz ^ 1) : dsz) == 0)
+				dest->target &= TULL(0xffff);
+			else
+				dest->target &= TULL(0xffffffff);
 		}
-
-		break;
 	}
+	return size;
+}
 
-	p.wait_used = got_fwait;
-	
-	// - Try to decode.
-	// - If there's an error:
-	//   - If wait was used:
-	//     - go back one byte, re-decode, return results.
-	//       that is, match the "wait" instruction, itself.
-	//   - If wait was not used:
-	//     - Return the error.
-	// - If there was no error:
-	//   - If wait was used:
-	//     - If insn is not wait-able
-	//       - match wait itself
-	//     - If insn was waitable
-	//       - return success
-	//   - If wait was not used:
-	//     - return success, unless insn length > 15 bytes,
-	//       in which case we want to return an error
-	
-	fetcher_copy = fetcher;
-	status = try_decode(&fetcher_copy, dest, dsz, &p, state_out);
-	dest->fwait = 0;  // not fwaitable
-	
-	if(*status != '\0')
+//===============================================================================================//
+
+// Packed icodes. Argument types and sizes aren't stored; they come from the
+// encoding table, the same way get_arguments() works them out.
+
+// Fills in argtype[] and argsize[] of dest for a packed icode.
+static void unpack_arguments(struct ix_icode_t *dest, U1 dsz, U1 mem_form)
+{
+	const struct crudasm_intel_encoding_hot_t *encoding = crudasm_intel_encoding_hot_table + dest->encoding;
+	const S1 *sizes = crudasm_intel_argsize_rows[encoding->argsize_index & crudasm_intel_argsize_row][argsize_combo(dsz, dest->osz, dest->asz)];
+	int i;
+	int done = 0;
+
+	for(i = 0; i < 4; ++i)
 	{
-		if(p.wait_used)
+		dest->argtype[i] = encoding->argtype[i];
+		dest->argsize[i] = sizes[i];
+		if(done || dest->argtype[i] == crudasm_intel_argtype_void)
 		{
-			// match wait, itself. discard any prefixes.
-			reset_prefix(&p);
-			fetcher_copy = fetcher;
-			++fetcher_copy.bytes_left;
-			--fetcher_copy.next_offset;
-			status = try_decode(&fetcher_copy, dest, dsz, &p, state_out);
-			dest->fwait = 0;
+			done = 1;
+			continue;
 		}
-		
-		return status;
+		if(mem_form && encoding->argvalue[i] == crudasm_intel_argvalue_reg_or_mem)
+			dest->argtype[i] = crudasm_intel_argtype_mem_ea;
 	}
-	
-	// Decode was successful.
-	if(p.wait_used)
+}
+
+int crudasm_intel_pack_icode(struct ix_packed_icode_t *dest, const struct ix_icode_t *src, U1 dsz, struct ix_packed_side_t *side, size_t *side_count)
+{
+	struct ix_icode_t check;
+	const struct crudasm_intel_encoding_hot_t *encoding;
+	int i;
+
+	if(src->encoding != 0xffffffff && src->encoding >= 0xffff)
+		return 0;
+
+	dest->encoding = (U2)(src->encoding);
+	dest->ea = (U2)(src->ea.base | (src->ea.index << 5) | (src->ea.index_scale << 10) | (src->ea.sreg << 12) | (src->ea.disp8 << 15));
+	dest->flags = (U2)(src->has_disp | (src->has_imm << 1) | (src->lockrep << 2) | (src->osz << 4) | (src->asz << 6) |
+		(src->sx << 8) | (src->rip_relative << 9) | (src->imm64 << 10) | (src->fwait << 11) | (src->is_nop << 13) | (src->rex_used << 14)
+	);
+	dest->dsz = dsz;
+	dest->mem_form = 0;
+	dest->reserved = 0;
+	for(i = 0; i < 4; ++i)
+		dest->argvalue[i] = src->argvalue[i];
+
+	if(src->encoding != 0xffffffff)
 	{
-		// check to see if encoding in question is fwaitable.
-		// if not, just match fwait (discarding any prefixes) as above.
-		if(!(crudasm_intel_insns[crudasm_intel_encoding_table[dest->encoding].insn].itags & crudasm_intel_itag_fwaitable))
+		// Make sure argument types and sizes can be recovered.
+		encoding = crudasm_intel_encoding_hot_table + src->encoding;
+		for(i = 0; i < 4 && encoding->argtype[i] != crudasm_intel_argtype_void; ++i)
 		{
-			// match wait, itself. discard any prefixes.
-			reset_prefix(&p);
-			fetcher_copy = fetcher;
-			++fetcher_copy.bytes_left;
-			--fetcher_copy.next_offset;
-			status = try_decode(&fetcher_copy, dest, dsz, &p, state_out);
-			dest->fwait = 0;
-			return status;
+			if(encoding->argvalue[i] == crudasm_intel_argvalue_reg_or_mem && src->argtype[i] == crudasm_intel_argtype_mem_ea)
+				dest->mem_form = 1;
+		}
+		check.encoding = src->encoding;
+		check.osz = src->osz;
+		check.asz = src->asz;
+		unpack_arguments(&check, dsz, dest->mem_form);
+		for(i = 0; i < 4; ++i)
+		{
+			if(check.argtype[i] != src->argtype[i] || check.argsize[i] != src->argsize[i])
+				return 0;
 		}
-		
-		// wait was used, and it is waitable.
-		dest->fwait = 2;  // fwaitable (fwait WAS used)
 	}
+
+	if(src->imm == 0 && src->disp == 0)
+		dest->side = 0xffffffff;
 	else
 	{
-		if(state_out->insn_size > 15)
-			return "instruction exceeds 15 bytes";
-		if(crudasm_intel_insns[crudasm_intel_encoding_table[dest->encoding].insn].itags & crudasm_intel_itag_fwaitable)
-			dest->fwait = 1;  // fwaitable (fwait not used)
+		dest->side = (U4)(*side_count);
+		side[*side_count].imm = src->imm;
+		side[*side_count].disp = src->disp;
+		++*side_count;
 	}
-	
-	return status;
+	return 1;
 }
 
-const char *crudasm_intel_decode(struct ix_icode_t *dest, U8 num_bytes, U1 dsz, U1 *buf, struct ix_decoder_state_t *state_out)
+void crudasm_intel_unpack_icode(struct ix_icode_t *dest, const struct ix_packed_icode_t *src, const struct ix_packed_side_t *side)
 {
-	struct ix_decoder_state_t state_tmp;
+	int i;
 
-	if(state_out == NULL)
-		state_out = &state_tmp;
-	
-	dest->encoding = 0xffffffff;
-	dest->has_disp = 0;
-	dest->has_imm = 0;
-	dest->lockrep = 0;
-	dest->osz = dsz;
-	dest->asz = dsz;
-	dest->sx = 0;
-	dest->rip_relative = 0;
-	dest->imm64 = 0;
-	dest->argtype[0] = crudasm_intel_argtype_void;
-	dest->argtype[1] = crudasm_intel_argtype_void;
-	dest->argtype[2] = crudasm_intel_argtype_void;
-	dest->argtype[3] = crudasm_intel_argtype_void;
-	dest->ea.base = 31;			// no base reg in ea
-	dest->ea.index = 31;		// no index reg in ea
-	dest->ea.sreg = 7;			// default ds segment
-	
-	// Max 30 bytes to decode: ignored prefixes, FWAIT, prefixes, insn.
-	return do_decode(dest, (num_bytes > 30) ? 30 : num_bytes, dsz, buf, state_out);
+	dest->encoding = (src->encoding == 0xffff) ? 0xffffffff : src->encoding;
+	dest->ea.base = src->ea & 31;
+	dest->ea.index = (src->ea >> 5) & 31;
+	dest->ea.index_scale = (src->ea >> 10) & 3;
+	dest->ea.sreg = (src->ea >> 12) & 7;
+	dest->ea.disp8 = (src->ea >> 15) & 1;
+	dest->has_disp = src->flags & 1;
+	dest->has_imm = (src->flags >> 1) & 1;
+	dest->lockrep = (src->flags >> 2) & 3;
+	dest->osz = (src->flags >> 4) & 3;
+	dest->asz = (src->flags >> 6) & 3;
+	dest->sx = (src->flags >> 8) & 1;
+	dest->rip_relative = (src->flags >> 9) & 1;
+	dest->imm64 = (src->flags >> 10) & 1;
+	dest->fwait = (src->flags >> 11) & 3;
+	dest->is_nop = (src->flags >> 13) & 1;
+	dest->rex_used = (src->flags >> 14) & 1;
+
+	if(src->side == 0xffffffff)
+	{
+		dest->imm = 0;
+		dest->disp = 0;
+	}
+	else
+	{
+		dest->imm = side[src->side].imm;
+		dest->disp = side[src->side].disp;
+	}
+
+	for(i = 0; i < 4; ++i)
+		dest->argvalue[i] = src->argvalue[i];
+	if(dest->encoding == 0xffffffff)
+	{
+		for(i = 0; i < 4; ++i)
+		{
+			dest->argtype[i] = crudasm_intel_argtype_void;
+			dest->argsize[i] = 0;
+		}
+	}
+	else
+		unpack_arguments(dest, src->dsz, src->mem_form);
 }
 
 //===============================================================================================//
@@ -5,6 +5,7 @@
 #define l_ixdecoder_h__crudasm_included
 
 #include "../crudasm_intel_include.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -83,12 +84,261 @@ struct ix_decoder_state_t
 	U1 prefix_size;		// added--valid even if prefixes ignored or used with fwait
 };
 
+// Decoder status codes, for crudasm_intel_decode_status(). Everything except
+// crudasm_intel_status_ok is a failure; crudasm_intel_status_message() gives the
+// message that crudasm_intel_decode() would return.
+enum
+{
+	crudasm_intel_status_ok = 0,
+	crudasm_intel_status_empty_buffer,		// num_bytes was 0
+	crudasm_intel_status_invalid_mode,
+	crudasm_intel_status_limit_exceeded,		// ran out of bytes (the suffix tells where)
+	crudasm_intel_status_limit_exceeded_0,
+	crudasm_intel_status_limit_exceeded_1,
+	crudasm_intel_status_limit_exceeded_2,
+	crudasm_intel_status_limit_exceeded_3,
+	crudasm_intel_status_limit_exceeded_4,
+	crudasm_intel_status_limit_exceeded_4_3,
+	crudasm_intel_status_limit_exceeded_4_4,
+	crudasm_intel_status_limit_exceeded_4_5,
+	crudasm_intel_status_limit_exceeded_4_7,
+	crudasm_intel_status_limit_exceeded_5,
+	crudasm_intel_status_limit_exceeded_6,
+	crudasm_intel_status_limit_exceeded_7,
+	crudasm_intel_status_limit_exceeded_8,
+	crudasm_intel_status_limit_exceeded_9,
+	crudasm_intel_status_limit_exceeded_10,
+	crudasm_intel_status_invalid_opcode,		// invalid or unsupported encoding
+	crudasm_intel_status_invalid_in_64bit,
+	crudasm_intel_status_bad_lock_1,
+	crudasm_intel_status_bad_lock_2,
+	crudasm_intel_status_bad_sreg,
+	crudasm_intel_status_too_long,			// more than 15 bytes
+	crudasm_intel_status_unsupported_argument,	// problems with the decoder tables
+	crudasm_intel_status_missing_imm64_sx32,
+	crudasm_intel_status_internal_error,
+	crudasm_intel_status_table_error,
+	crudasm_intel_status_not_fwaitable,	// internal, never returned
+	crudasm_intel_status__count
+};
+
 // Returns "" on success. Else an error message is returned.
 // state_out may be NULL if you don't care about it.
 // dsz == 0 for 16 bit mode, 1 for 32 bit mode, 2 for 64 bit mode.
 // num_bytes == number of bytes remaining in buf, should be at least 1 !
 const char *crudasm_intel_decode(struct ix_icode_t *dest, U8 num_bytes, U1 dsz, U1 *buf, struct ix_decoder_state_t *state_out);
 
+// Same as crudasm_intel_decode(), but returns a crudasm_intel_status_* code.
+int crudasm_intel_decode_status(struct ix_icode_t *dest, U8 num_bytes, U1 dsz, U1 *buf, struct ix_decoder_state_t *state_out);
+
+// Returns the message for a crudasm_intel_status_* code ("" for crudasm_intel_status_ok).
+const char *crudasm_intel_status_message(int status);
+
+// Per-thread decode statistics. These are only kept if the decoder is built
+// with CRUDASM_DECODE_STATS defined; otherwise they stay zero. Every call to
+// crudasm_intel_decode(), crudasm_intel_decode_status(), crudasm_intel_decode16/32/64()
+// and every instruction of crudasm_intel_decode_batch() counts once, as does every
+// offset that crudasm_intel_decode_superset() decodes and every call to
+// crudasm_intel_decode_cached() (hit or not).
+struct crudasm_intel_decode_stats_t
+{
+	U8 decodes;
+	U8 failures[crudasm_intel_status__count];	// indexed by status; failures[0] is unused
+};
+
+// Copies the calling thread's statistics to stats.
+void crudasm_intel_get_decode_stats(struct crudasm_intel_decode_stats_t *stats);
+
+// Zeros the calling thread's statistics.
+void crudasm_intel_reset_decode_stats(void);
+
+// Same as crudasm_intel_decode(), for a decoder mode known in advance. These are
+// compiled separately for each mode, so use them when decoding a lot of code.
+const char *crudasm_intel_decode16(struct ix_icode_t *dest, U8 num_bytes, U1 *buf, struct ix_decoder_state_t *state_out);
+const char *crudasm_intel_decode32(struct ix_icode_t *dest, U8 num_bytes, U1 *buf, struct ix_decoder_state_t *state_out);
+const char *crudasm_intel_decode64(struct ix_icode_t *dest, U8 num_bytes, U1 *buf, struct ix_decoder_state_t *state_out);
+
+// Structure-of-arrays output for crudasm_intel_decode_batch(). The arrays are
+// owned by the caller and must each have room for max_insns entries. There is
+// one entry per decoded instruction; a byte that could not be decoded gets an
+// entry of its own, with length 1 and encoding 0xffffffff.
+struct ix_decode_batch_t
+{
+	U8 *offsets;			// offset in given buffer of each instruction
+	U1 *lengths;			// instruction size in bytes
+	U4 *encodings;			// encoding index, or 0xffffffff if invalid
+	struct ix_icode_t *icodes;	// operand records (may be NULL if you don't care about it)
+	const char **status;		// "" or error message (may be NULL if you don't care about it)
+
+	// These are outputs.
+	size_t count;			// number of entries written
+	U8 next_offset;			// offset in given buffer where decoding stopped
+};
+
+// Decodes up to max_insns instructions, starting at buf[0] and stopping once
+// all len bytes have been consumed. Returns the number of entries written.
+// Call again with buf + out_soa->next_offset to continue a linear sweep.
+size_t crudasm_intel_decode_batch(U1 *buf, U8 len, U1 dsz, struct ix_decode_batch_t *out_soa, size_t max_insns);
+
+// Called by the stream decoder for each instruction, in order. offset is the
+// stream offset of the instruction, and bytes points to its size bytes (only
+// valid during the call). If status isn't crudasm_intel_status_ok, the byte at
+// offset couldn't be decoded and size is 1.
+typedef void (*crudasm_intel_stream_callback_t)(void *context, U8 offset, const U1 *bytes, U1 size, struct ix_icode_t *icode, struct ix_decoder_state_t *state, int status);
+
+// Decodes a stream of code that arrives in chunks of any size, with the same
+// results as a linear sweep over all of it (see crudasm_intel_decode_batch()).
+// Only the tail of a chunk that might hold a partial instruction (fewer than
+// 30 bytes) is copied; the rest is decoded in place.
+struct crudasm_intel_stream_t
+{
+	U1 dsz;
+	U1 carry_size;		// number of bytes in carry
+	U1 carry[30];		// bytes at the end of the last chunk, not decoded yet
+	U8 offset;		// stream offset of the next byte to decode
+	crudasm_intel_stream_callback_t callback;
+	void *context;
+};
+
+// Starts a stream. start_offset is the offset given to the callback for the
+// first byte of the stream.
+void crudasm_intel_stream_init(struct crudasm_intel_stream_t *stream, U1 dsz, U8 start_offset, crudasm_intel_stream_callback_t callback, void *context);
+
+// Decodes the next len bytes of the stream. buf need not be kept afterwards.
+void crudasm_intel_stream_feed(struct crudasm_intel_stream_t *stream, U1 *buf, size_t len);
+
+// Decodes whatever is left at the end of the stream.
+void crudasm_intel_stream_finish(struct crudasm_intel_stream_t *stream);
+
+// Superset disassembly: the instruction at every byte offset of a buffer, for
+// looking at code that may overlap itself. The arrays are owned by the caller
+// and have one entry per byte of the whole buffer. Any of them may be NULL.
+struct ix_superset_t
+{
+	U1 *lengths;			// instruction size, or 0 if nothing valid decodes here
+	U1 *status;			// crudasm_intel_status_* code
+	U4 *encodings;			// encoding index, or 0xffffffff if invalid
+};
+
+// Fills in entries [begin, end) of out, as crudasm_intel_decode() at each of
+// those offsets of buf (len bytes in all) would. Offsets that start with a
+// prefix which changes nothing (e.g. the first 66 of 66 66 0f 1f ...) are
+// filled in from the next offset rather than decoded again. Different regions
+// of a buffer may be done separately, e.g. from several threads, with the same
+// results. Returns the number of offsets that had to be decoded.
+size_t crudasm_intel_decode_superset(U1 *buf, U8 len, U1 dsz, U8 begin, U8 end, struct ix_superset_t *out);
+
+// Builds the fall-through graph of a superset, i.e. offset i leads to offset
+// i + lengths[i] when that is inside the buffer, in compressed form: the
+// offsets leading to offset j are preds[first[j]] to preds[first[j + 1] - 1],
+// in increasing order. first has len + 1 entries and preds has len entries.
+// Offsets are 32 bits, so len must be less than 4 GB.
+void crudasm_intel_superset_preds(const U1 *lengths, U8 len, U4 *first, U4 *preds);
+
+// Decode cache. Code tends to repeat the same instructions over and over
+// (padding, prologues, import stubs, ...), so this remembers the results of
+// recent decodes. It is direct-mapped, with 2^CRUDASM_DECODE_CACHE_BITS
+// entries, indexed by the mode and the first CRUDASM_DECODE_CACHE_PREFIX
+// bytes at buf (at most 8), so a lookup doesn't need the instruction's
+// length. Each entry keeps the size and bytes of its instruction next to the
+// results, in one 64-byte record, and a hit compares just those bytes. The
+// structure is large (1 MB by default), so don't put it on the stack. Use one
+// cache per thread.
+#ifndef CRUDASM_DECODE_CACHE_BITS
+#define CRUDASM_DECODE_CACHE_BITS 14
+#endif
+#ifndef CRUDASM_DECODE_CACHE_PREFIX
+#define CRUDASM_DECODE_CACHE_PREFIX 3
+#endif
+#define CRUDASM_DECODE_CACHE_SIZE (1 << CRUDASM_DECODE_CACHE_BITS)
+
+struct crudasm_intel_decode_cache_entry_t
+{
+	U1 key[16];	// (dsz << 4) | size, then the instruction bytes; all 0 if unused
+	struct ix_icode_t icode;
+	struct ix_decoder_state_t state;
+	U1 pad[64 - 16 - sizeof(struct ix_icode_t) - sizeof(struct ix_decoder_state_t)];
+};
+
+struct crudasm_intel_decode_cache_t
+{
+	struct crudasm_intel_decode_cache_entry_t entries[CRUDASM_DECODE_CACHE_SIZE];
+
+	// Statistics.
+	U8 lookups;			// calls to crudasm_intel_decode_cached()
+	U8 hits;
+	U8 uncacheable;			// failed decodes, and instructions that involve an FWAIT
+};
+
+// Empties the cache and zeros its statistics.
+void crudasm_intel_decode_cache_init(struct crudasm_intel_decode_cache_t *cache);
+
+// Same as crudasm_intel_decode_status(), but looks in the cache first. Only
+// instructions that decoded successfully are cached, and only when the result
+// depends on nothing but their own bytes (i.e. no FWAIT is involved).
+int crudasm_intel_decode_cached(struct crudasm_intel_decode_cache_t *cache, struct ix_icode_t *dest, U8 num_bytes, U1 dsz, U1 *buf, struct ix_decoder_state_t *state_out);
+
+// Returns the size in bytes of the instruction at buf, or 0 if
+// crudasm_intel_decode() would fail. This is much faster than a full decode,
+// because it only looks at enough of the instruction to know where it ends.
+// Parameters are the same as for crudasm_intel_decode().
+U1 crudasm_intel_insn_length(U8 num_bytes, U1 dsz, U1 *buf);
+
+// There are three depths of decoding: crudasm_intel_insn_length() gives only
+// the size of an instruction, crudasm_intel_decode() gives everything, and
+// crudasm_intel_decode_control() is in between. It gives the size, the
+// encoding, and what the instruction does to control flow--enough to follow
+// the code, e.g. for building a control flow graph. Registers, immediates and
+// the effective address aren't worked out, so it costs about the same as a
+// length decode. For instructions already decoded, the same control flow
+// information is crudasm_intel_control_table[icode.encoding].
+struct ix_control_info_t
+{
+	U4 encoding;		// encoding index, or 0xffffffff if invalid insn
+	U1 size;		// instruction size, or 0 if invalid insn
+	U2 control;		// crudasm_intel_control_table[] entry (crudasm_intel_control_* values)
+	U8 target;		// branch target if crudasm_intel_control_relative, else 0
+};
+
+// Returns the size in bytes of the instruction at buf and fills in *dest, or
+// returns 0 if crudasm_intel_decode() would fail. address is the address of
+// buf[0], which the branch target is relative to; outside of 64bit mode the
+// target wraps around at the operand size, like the disassembler does. Other
+// parameters are the same as for crudasm_intel_decode().
+U1 crudasm_intel_decode_control(struct ix_control_info_t *dest, U8 num_bytes, U1 dsz, U1 *buf, U8 address);
+
+// Packed form of ix_icode_t (16 bytes), for keeping large numbers of decoded
+// instructions in memory. Argument types and sizes are worked out again from
+// the encoding table when unpacking. imm and disp go in a side array, and
+// only when one of them is nonzero.
+struct ix_packed_icode_t
+{
+	U4 side;		// index in the side array, or 0xffffffff if imm and disp are both 0
+	U2 encoding;		// 0xffff means invalid insn
+	U2 ea;			// struct ix_ea_t, base in the low bits
+	U2 flags;		// has_disp .. rex_used, in ix_icode_t order starting at bit 0
+	U1 dsz : 2;		// decoder mode used
+	U1 mem_form : 1;	// reg/mem argument is memory (modr/m < 0xc0)
+	U1 : 5;
+	U1 reserved;
+	U1 argvalue[4];
+};
+
+struct ix_packed_side_t
+{
+	U4 imm;
+	U4 disp;
+};
+
+// Packs src, which was decoded with the given dsz. If imm or disp is nonzero,
+// they are stored at side[*side_count] and *side_count is incremented, so side
+// must have room for one more entry. Returns 1 on success, or 0 if src can't
+// be packed without losing information (dest and side are then undefined).
+int crudasm_intel_pack_icode(struct ix_packed_icode_t *dest, const struct ix_icode_t *src, U1 dsz, struct ix_packed_side_t *side, size_t *side_count);
+
+// Restores an icode packed by crudasm_intel_pack_icode().
+void crudasm_intel_unpack_icode(struct ix_icode_t *dest, const struct ix_packed_icode_t *src, const struct ix_packed_side_t *side);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,739 @@
+// ixdecoder_mode.h
+// This is not a normal header. ixdecoder.c includes it once per decoder mode,
+// with IXDEC_DSZ defined as 0 (16 bit), 1 (32 bit) or 2 (64 bit), and with
+// IXDEC_NAME(x) defined to give each function a per-mode name. That way each
+// mode's decoder has its dsz tests resolved at compile time.
+
+// pre: dest->asz must be set already.
+static int IXDEC_NAME(get_modrm)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state)
+{
+	U1 c;
+	int disp_size;
+	U8 disp;
+	const struct modrm_desc_t *m;
+	const struct sib_desc_t *sib;
+
+	state->modrm_offset = fetcher->next_offset;
+
+	if(!fetch_byte(fetcher, &c))
+		return 0;
+	accept_byte(fetcher);
+	state->modrm0 = c;
+	state->has_modrm = 1;
+	dest->disp = 0;		// no displacement yet
+
+	if(c >= 0xc0)
+		return 1;	// register form
+
+#if IXDEC_DSZ == 2
+	m = modrm_desc_32 + (((c >> 3) & 0x18) | (c & 7));
+#else
+	m = ((dest->asz == 0) ? modrm_desc_16 : modrm_desc_32) + (((c >> 3) & 0x18) | (c & 7));
+#endif
+	dest->ea.base = m->base;
+	dest->ea.index = m->index;
+	disp_size = m->disp_size;
+
+	if(m->sib_row != 0)
+	{
+		if(!fetch_byte(fetcher, &c))
+			return 0;
+		accept_byte(fetcher);
+		sib = sib_desc[m->sib_row - 1] + c;
+		dest->ea.base = sib->base;
+		dest->ea.index = sib->index;
+		dest->ea.index_scale = sib->index_scale;
+		disp_size += sib->disp_size;
+	}
+
+#if IXDEC_DSZ == 2
+	if((state->modrm0 & 0xc7) == 0x05)
+	{
+		// According to the AMD manual, this is all we have to do here.
+		dest->rip_relative = 1;
+	}
+	else
+	{
+		if(dest->ea.base != 31)
+			dest->ea.base += (p->rex_b << 3);
+		if(m->sib_row != 0 && p->rex_x)
+		{
+			// With rex.x, an index of 4 means r12 rather than no index.
+			dest->ea.index = ((c >> 3) & 7) + 8;
+			dest->ea.index_scale = (c >> 6) & 3;
+		}
+	}
+#endif
+
+	// Handle displacement.
+	if(disp_size > 0)
+	{
+		dest->has_disp = 1;
+		state->disp_offset = (U1)(fetcher->next_offset);
+		if(!fetch_le(fetcher, (U1)(disp_size), &disp))
+			return 0;
+		dest->disp = (U4)(disp);
+		if(disp_size == 1)
+		{
+			dest->ea.disp8 = 1;	// forgot this the 1st time (fixed 2/1/2011)
+			if(dest->asz == 0)
+				dest->disp = (U4)(U2)(S2)(S1)(dest->disp);
+			else
+				dest->disp = (U4)(S4)(S1)(dest->disp);
+		}
+	}
+
+	if(p->sreg == 7 && dest->ea.base != 31 && (dest->ea.base & 6) == 4)
+		dest->ea.sreg = 6;		// bp, ebp, or esp base registers use SS:
+
+	return 1;
+}
+
+#ifndef CRUDASM_COMPILED_ARGS
+
+// Returns crudasm_intel_status_ok on success, else an error code.
+static int IXDEC_NAME(get_arguments)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const struct crudasm_intel_encoding_hot_t *encoding)
+{
+	int i, disp_size_2;
+	U1 type, rm_reg_shift, rm_rex_reg, immvalue, valbase;
+	U8 disp, value;
+	int imm2nd;
+	U4 *imm_out;
+	S2 size;
+	const S1 *sizes = crudasm_intel_argsize_rows[encoding->argsize_index & crudasm_intel_argsize_row][argsize_combo(IXDEC_DSZ, dest->osz, dest->asz)];
+	
+	// Void arguments have a size of 0 in every row.
+	for(i = 0; i < 4; ++i)
+	{
+		dest->argtype[i] = encoding->argtype[i];
+		dest->argsize[i] = sizes[i];
+		dest->argvalue[i] = encoding->argvalue[i];
+	}
+
+	for(i = 0; i < 4; ++i)
+	{
+		type = dest->argtype[i];
+		if(type == crudasm_intel_argtype_void)
+			break;
+		rm_reg_shift = 3;
+		rm_rex_reg = p->rex_r;
+
+		if(sizes[i] <= 0)
+			return crudasm_intel_status_unsupported_argument;
+
+		if(dest->argvalue[i] == crudasm_intel_argvalue_reg_or_mem)
+		{
+			// Argument is reg/mem, where reg is any kind of register.
+			//type &= 0x7f;
+			rm_reg_shift = 0;
+			rm_rex_reg = p->rex_b;
+			if(state->modrm0 < 0xc0)
+				type = dest->argtype[i] = crudasm_intel_argtype_mem_ea;
+			dest->argvalue[i] = crudasm_intel_argvalue_default;
+		}
+
+		if(type == crudasm_intel_argtype_mem_fulldisp)
+		{
+			dest->has_disp = 1;
+			state->disp_offset = (U1)(fetcher->next_offset);
+			disp_size_2 = 2 << dest->asz;
+			if(!fetch_le(fetcher, (U1)(disp_size_2), &disp))
+				return crudasm_intel_status_limit_exceeded_7;
+			dest->disp = (U4)(disp);
+			if(disp_size_2 == 8)
+				dest->imm = (U4)((disp >> 16) >> 16);
+		}
+		else
+		if(crudasm_intel_argtype__is_imm(type))
+		{
+			imm2nd = (type == crudasm_intel_argtype_imm_2nd);
+			imm_out = (imm2nd) ? &dest->disp : &dest->imm;
+
+			if(type == crudasm_intel_argtype_imm_implict)
+			{
+				*imm_out = dest->argvalue[i];	// zero extend the implict value given
+			}
+			else
+			{
+				// imm1_offset, imm2_offset apply only to non-implict immediates.
+				if(imm2nd)
+					state->imm2_offset = (U1)(fetcher->next_offset);
+				else
+					state->imm1_offset = (U1)(fetcher->next_offset);
+
+				// Need to fetch this immediate.
+				if(encoding->etags & crudasm_intel_etag_sx_byte)
+				{
+					if(dest->argsize[i] == 1)
+						return crudasm_intel_status_internal_error;	// sx_byte should not be used with byte-sized immediates
+					dest->sx = 1;
+
+					if(!fetch_byte(fetcher, &immvalue))
+						return crudasm_intel_status_limit_exceeded_8;
+					accept_byte(fetcher);
+					
+					if(dest->osz == 0)
+						*imm_out = (U4)(U2)(S2)(S1)(immvalue);
+					else
+					{
+						// Note: if imm arg's size is 64 bits, then one has to sign extend
+						// s.icode->imm to 64 bits if 'ixflag_imm64_sx32' is used. Otherwise,
+						// 'ixflag_imm64_disp' should be used, meaning the immediate was
+						// actually encoded as a 64bit value--in which case s.icode->disp
+						// holds the upper 32 bits of the immediate. This never happens when
+						// 'ixflag_sx_byte' is used, however.
+						*imm_out = (U4)(S4)(S1)(immvalue);
+					}
+				}	// sx_byte
+				else
+				if(dest->argsize[i] == 8 && (encoding->etags & crudasm_intel_etag_imm64_disp))
+				{
+					// Fetch 64 bits.
+					if(!fetch_le(fetcher, 8, &value))
+						return crudasm_intel_status_limit_exceeded_9;
+					dest->imm = (U4)(value);
+					dest->disp = (U4)((value >> 16) >> 16);
+					dest->imm64 = 1;
+				}
+				else
+				{
+					size = dest->argsize[i];
+					if(size == 8)
+					{
+						if(!(encoding->etags & crudasm_intel_etag_imm64_sx32))
+							return crudasm_intel_status_missing_imm64_sx32;
+						size = 4;
+					}
+					// Fetch 'size' bytes.
+					if(!fetch_le(fetcher, (U1)(size), &value))
+						return crudasm_intel_status_limit_exceeded_10;
+					*imm_out = value;
+				}
+			}
+		}
+		else
+		if(crudasm_intel_argtype__is_reg(type))
+		{
+			if(dest->argvalue[i] == crudasm_intel_argvalue_default)
+			{
+				if(type == crudasm_intel_argtype_reg_gr)
+				{
+					U1 value = dest->argvalue[i];
+					if(encoding->etags & crudasm_intel_etag_reg_base)
+					{
+						value = state->opcode0 & 7;
+						value += (U1)(p->rex_b) << 3;
+					}
+					else
+					if(encoding->etags & crudasm_intel_etag_reg_rm)
+					{
+						// Is this right ?
+						value = (state->modrm0 & 7) + ((U1)(p->rex_b) << 3);
+					}
+					else
+					{
+						value = (state->modrm0 >> rm_reg_shift) & 7;
+						value += rm_rex_reg << 3;
+					}
+					dest->argvalue[i] = value;
+				}
+				else
+				if(type == crudasm_intel_argtype_reg_sr)
+				{
+					dest->argvalue[i] = (state->modrm0 >> 3) & 7;
+					if(dest->argvalue[i] > 5)
+						return crudasm_intel_status_bad_sreg;
+				}
+				else
+				{
+					valbase = ((state->modrm0 >> rm_reg_shift) & 7);
+					if(encoding->etags & crudasm_intel_etag_reg_base)
+						valbase = state->opcode0 & 7;
+					else
+					if(encoding->etags & crudasm_intel_etag_reg_rm)
+						valbase = (state->modrm0 & 7) + ((U1)(p->rex_b) << 3);
+					else
+						valbase += (rm_rex_reg << 3);
+					dest->argvalue[i] = valbase;
+				}
+			}
+		}
+	}
+
+	return crudasm_intel_status_ok;
+}
+
+#else
+
+#include "../generated/out_intel_decode_funcs.h"
+
+// Returns crudasm_intel_status_ok on success, else an error code.
+static int IXDEC_NAME(get_arguments)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state, const struct crudasm_intel_encoding_hot_t *encoding)
+{
+	const S1 *sizes = crudasm_intel_argsize_rows[encoding->argsize_index & crudasm_intel_argsize_row][argsize_combo(IXDEC_DSZ, dest->osz, dest->asz)];
+	return IXDEC_NAME(decode_args)[dest->encoding](fetcher, dest, p, state, sizes);
+}
+
+#endif	// CRUDASM_COMPILED_ARGS
+
+static int IXDEC_NAME(try_decode)(struct code_fetcher_t *fetcher, struct ix_icode_t *dest, struct decode_prefix_state_t *p, struct ix_decoder_state_t *state)
+{
+	U1 c;
+	int got_modrm = 0;
+	U2 entry;
+	size_t offset;
+	U1 type;
+	const U2 *decoder_table;
+	int done;
+	size_t op66, lockrep;
+	const struct crudasm_intel_encoding_hot_t *encoding;
+#if IXDEC_DSZ == 2
+	int is64;
+#endif
+	int msg;
+
+	state->prefix_size = fetcher->next_offset;
+	state->rex_used = p->rex_used;
+	state->wait_used = p->wait_used;
+	state->has_modrm = 0;
+	state->disp_offset = 255;
+	state->imm1_offset = 255;
+	state->imm2_offset = 255;
+	state->modrm_offset = 255;
+	
+	if(fetcher->bytes_left == 0)
+		return crudasm_intel_status_limit_exceeded_0;
+
+	if(!fetch_byte(fetcher, &c))
+		return crudasm_intel_status_limit_exceeded_1;
+	state->opcode0 = c;
+	state->modrm0 = 0;	// normalize value
+
+	if(state->opcode0 == 0x0f)
+	{
+		if(fetcher->bytes_left < 2)
+			return crudasm_intel_status_limit_exceeded_2;
+		state->opcode0 = fetcher->buf[fetcher->next_offset + 1];
+		state->opcode0 += 0x100;
+	}
+
+	// Resolve the opcode byte(s) and the 66/f2/f3 splitter with one lookup
+	// in the flattened table; the tree walk below handles what is left.
+	op66 = (p->op66) ? 1 : 0;
+	lockrep = 0;
+	if(p->lockrep == 2)
+		lockrep = 1;
+	else
+	if(p->lockrep == 3)
+		lockrep = 2;
+	entry = crudasm_intel_decoder_flat_table[(op66 + 2 * lockrep) * 0x200 + state->opcode0];
+	offset = entry & crudasm_intel_decoder_offset;
+	type = entry >> crudasm_intel_decoder_type_shift;
+	accept_byte(fetcher);
+	if(state->opcode0 >= 0x100)
+		accept_byte(fetcher);
+
+	// Before we begin, make dest->asz valid.
+#if IXDEC_DSZ == 0
+	dest->asz = (p->op67) ? 1 : 0;
+#elif IXDEC_DSZ == 1
+	dest->asz = (p->op67) ? 0 : 1;
+#else
+	// 64 bit mode.
+	dest->asz = (p->op67) ? 1 : 2;
+#endif
+
+	dest->lockrep = p->lockrep;
+	dest->ea.sreg = p->sreg;
+	dest->rip_relative = 0;
+	dest->ea.index_scale = 0;
+	dest->ea.disp8 = 0;
+	dest->is_nop = (state->opcode0 == 0x90) ? 1 : 0;
+	dest->rex_used = state->rex_used;
+
+	decoder_table = crudasm_intel_decoder_table;
+
+	done = 0;
+	do
+	{
+		switch(type)
+		{
+		case 0:
+		{
+			state->encoding_index = (U4)(offset);
+			if(state->encoding_index == crudasm_intel_decoder_invalid)
+				return crudasm_intel_status_invalid_opcode;
+			done = 1;
+			break;
+		}
+		case 1:
+		{
+			// An opcode byte, high nibble first; type 8 below does the low nibble.
+			if(!fetch_byte(fetcher, &c))
+				return crudasm_intel_status_limit_exceeded_3;
+			offset += (size_t)(c >> 4);
+			type = decoder_table[offset] >> crudasm_intel_decoder_type_shift;
+			offset = decoder_table[offset] & crudasm_intel_decoder_offset;
+			accept_byte(fetcher);
+			break;
+		}
+		case 8:
+		{
+			offset += (size_t)(c & 0xf);
+			type = decoder_table[offset] >> crudasm_intel_decoder_type_shift;
+			offset = decoder_table[offset] & crudasm_intel_decoder_offset;
+			break;
+		}
+		case 6:
+		{
+#if IXDEC_DSZ == 2
+			++offset;
+#endif
+			type = decoder_table[offset] >> crudasm_intel_decoder_type_shift;
+			offset = decoder_table[offset] & crudasm_intel_decoder_offset;
+			break;
+		}
+		case 2:
+		{
+			op66 = (p->op66) ? 1 : 0;
+			lockrep = 0;
+			if(p->lockrep == 2)
+				lockrep = 1;
+			else
+			if(p->lockrep == 3)
+				lockrep = 2;
+			offset += op66 + 2 * lockrep;
+			type = decoder_table[offset] >> crudasm_intel_decoder_type_shift;
+			offset = decoder_table[offset] & crudasm_intel_decoder_offset;
+			break;
+		}
+		case 3:
+		case 4:
+		case 5:
+		case 7:
+		{
+			if(!got_modrm)
+			{
+				got_modrm = 1;
+				if(!IXDEC_NAME(get_modrm)(fetcher, dest, p, state))
+				{
+					if(type == 3)
+						return crudasm_intel_status_limit_exceeded_4_3;
+					if(type == 4)
+						return crudasm_intel_status_limit_exceeded_4_4;
+					if(type == 5)
+						return crudasm_intel_status_limit_exceeded_4_5;
+					if(type == 7)
+						return crudasm_intel_status_limit_exceeded_4_7;
+					return crudasm_intel_status_limit_exceeded_4;
+				}
+			}
+			if(type == 3)
+				offset += (size_t)(state->modrm0 >> 3);
+			else
+			if(type == 4)
+				offset += (size_t)((state->modrm0 >> 3) & 7);
+			else
+			if(type == 5)
+				offset += (size_t)(state->modrm0 & 7);
+			else
+			{
+				if(!fetch_byte(fetcher, &c))
+					return crudasm_intel_status_limit_exceeded_5;
+				accept_byte(fetcher);
+				offset += (size_t)(c);
+			}
+			type = decoder_table[offset] >> crudasm_intel_decoder_type_shift;
+			offset = decoder_table[offset] & crudasm_intel_decoder_offset;
+			break;
+		}
+		default:
+			return crudasm_intel_status_table_error;
+		}
+	}	while(!done);
+	
+	encoding = crudasm_intel_encoding_hot_table + state->encoding_index;
+	///dest->insn = (U4)(encoding->insn);
+	dest->encoding = state->encoding_index;
+	
+	///printf("Instruction = [%s]\n", insn->name);
+
+	// After an FWAIT, anything that isn't fwaitable decodes as the FWAIT by
+	// itself (see do_decode()), so there's no point in going further.
+	if(p->wait_used && !(encoding->itags & crudasm_intel_itag_fwaitable))
+		return crudasm_intel_status_not_fwaitable;
+
+#if IXDEC_DSZ == 2
+	if(encoding->etags & crudasm_intel_etag_no64)
+		return crudasm_intel_status_invalid_in_64bit;
+#endif
+
+	if(!got_modrm && encoding->has_modrm)
+	{
+		got_modrm = 1;
+		if(!IXDEC_NAME(get_modrm)(fetcher, dest, p, state))
+			return crudasm_intel_status_limit_exceeded_6;
+	}
+	
+#if IXDEC_DSZ == 0
+	dest->osz = (p->op66) ? 1 : 0;
+#elif IXDEC_DSZ == 1
+	dest->osz = (p->op66) ? 0 : 1;
+#else
+	dest->osz = (p->op66) ? 0 : 1;
+	if(!(encoding->etags & crudasm_intel_etag_no_rex_w))
+	{
+		is64 = ((encoding->etags & crudasm_intel_etag_is64) != 0);
+		if(p->rex_w != 0 || is64)
+		{
+			// Note: 0x66 is ignored if used with rex.w (AMD manual).
+			// However, if it's is64 and 66 is used WITHOUT a rex.w,
+			// make osz 16 bits.
+			dest->osz = 2;
+			if(p->op66 && is64 && p->rex_w == 0)
+				dest->osz = 0;
+		}
+	}
+#endif
+
+	// Process arguments.
+	dest->has_imm = 0;		// redundant
+	dest->imm64 = 0;
+	dest->sx = 0;
+
+	msg = IXDEC_NAME(get_arguments)(fetcher, dest, p, state, encoding);
+	if(msg != crudasm_intel_status_ok)
+		return msg;
+
+	// Check for bad LOCK usage.
+	if(dest->lockrep == 1)
+	{
+		if(!(encoding->itags & crudasm_intel_itag_lockable) && !(encoding->itags & crudasm_intel_itag_lock_always))
+		{
+			return crudasm_intel_status_bad_lock_1;
+		}
+		// ok, instruction is lockable (or is always locked).
+		///U1 first_argtype_major = encoding->argtype[0] & 0xe0;
+		if(!crudasm_intel_argtype__is_mem(dest->argtype[0]))
+		{
+			return crudasm_intel_status_bad_lock_2;
+		}
+		// if here, lock was used and IS allowed.
+		// note that the 1st argument of xchg must be a memory argument in
+		// the script in order for lock to be usable with it.
+	}
+
+	state->insn_size = (U1)(fetcher->next_offset);
+	return crudasm_intel_status_ok;	// success
+}
+
+// Fetches any prefixes, including a single FWAIT and any prefixes after it.
+// Afterwards, fetcher->next_offset is the offset of the opcode.
+// Returns 0 if we ran out of bytes.
+static int IXDEC_NAME(fetch_prefixes)(struct code_fetcher_t *fetcher, struct decode_prefix_state_t *p)
+{
+	U1 c;
+	U2 cls;
+	U1 got_fwait = 0;
+
+	for(;;)
+	{
+		// If we use FWAIT, relevant prefixes go after the FWAIT, i.e. any
+		// prefixes before the FWAIT are ignored.
+		reset_prefix(p);
+
+		// Fetch standard x86 prefixes.
+		for(;;)
+		{
+			if(!fetch_byte(fetcher, &c))
+			{
+				if(got_fwait)
+				{
+					reset_prefix(p);	// for consistency, drop all prefixes from fwait
+					// note that p->wait_used is undefined if the insn itself is fwait!
+					p->wait_used = got_fwait;
+					return 1;
+				}
+				return 0;
+			}
+
+			cls = prefix_class[c];
+			if(!(cls & ix_prefix_legacy))
+				break;
+			if(cls & ix_prefix_seg)
+				p->sreg = cls & 7;
+			else
+			if(cls & ix_prefix_66)
+				p->op66 = 1;
+			else
+			if(cls & ix_prefix_67)
+				p->op67 = 1;
+			else
+			if(cls & ix_prefix_lock)
+				p->lockrep = 1;
+			else
+			if(p->lockrep == 0)
+				p->lockrep = cls & 3;	// 0xf0 overrides 0xf2, 0xf3.
+		
+			accept_byte(fetcher);
+		}
+
+#if IXDEC_DSZ == 2
+		// now (in 64-bit mode) get any REX prefix.
+		if(cls & ix_prefix_rex)
+		{
+			p->rex_used = 1;
+
+			p->rex_w = (cls >> 3) & 1;
+			p->rex_r = (cls >> 2) & 1;
+			p->rex_x = (cls >> 1) & 1;
+			p->rex_b = (cls >> 0) & 1;
+
+			// byte was accepted.
+			accept_byte(fetcher);
+			if(!fetch_byte(fetcher, &c))
+				break;
+			cls = prefix_class[c];
+		}
+#endif
+
+		if((cls & ix_prefix_fwait) && !got_fwait)
+		{
+			got_fwait = 1;
+			p->wait_offset = (U1)(fetcher->next_offset);
+			accept_byte(fetcher);
+			continue;
+		}
+
+		break;
+	}
+
+	p->wait_used = got_fwait;
+	return 1;
+}
+
+// Decodes the FWAIT at buf[offset] as an instruction by itself, without any
+// prefixes. This gives the same result as try_decode() would, and is used by
+// do_decode() when the FWAIT can't be combined with the next instruction.
+static int IXDEC_NAME(decode_fwait)(struct ix_icode_t *dest, U1 *buf, U1 offset, struct ix_decoder_state_t *state)
+{
+	struct code_fetcher_t fetcher;
+	struct decode_prefix_state_t p;
+	const struct crudasm_intel_encoding_hot_t *encoding;
+	int msg;
+
+	reset_prefix(&p);
+	fetcher.buf = buf;
+	fetcher.bytes_left = 0;		// FWAIT has no operands to fetch
+	fetcher.next_offset = offset + 1;
+
+	state->encoding_index = crudasm_intel_decoder_flat_table[0x9b] & crudasm_intel_decoder_offset;
+	state->prefix_size = offset;
+	state->rex_used = 0;
+	state->wait_used = 0;
+	state->has_modrm = 0;
+	state->disp_offset = 255;
+	state->imm1_offset = 255;
+	state->imm2_offset = 255;
+	state->modrm_offset = 255;
+	state->opcode0 = 0x9b;
+	state->modrm0 = 0;
+
+	encoding = crudasm_intel_encoding_hot_table + state->encoding_index;
+	dest->encoding = state->encoding_index;
+	dest->asz = IXDEC_DSZ;
+	dest->lockrep = 0;
+	dest->has_disp = 0;
+	dest->disp = 0;
+	dest->imm = 0;
+	dest->ea.base = 31;
+	dest->ea.index = 31;
+	dest->ea.sreg = 7;
+	dest->ea.index_scale = 0;
+	dest->ea.disp8 = 0;
+	dest->rip_relative = 0;
+	dest->is_nop = 0;
+	dest->rex_used = 0;
+	dest->has_imm = 0;
+	dest->imm64 = 0;
+	dest->sx = 0;
+	dest->fwait = 0;
+#if IXDEC_DSZ == 2
+	dest->osz = 1;
+	if(!(encoding->etags & crudasm_intel_etag_no_rex_w) && (encoding->etags & crudasm_intel_etag_is64))
+		dest->osz = 2;
+#else
+	dest->osz = IXDEC_DSZ;
+#endif
+
+	msg = IXDEC_NAME(get_arguments)(&fetcher, dest, &p, state, encoding);
+	if(msg != crudasm_intel_status_ok)
+		return msg;
+
+	state->insn_size = offset + 1;
+	return crudasm_intel_status_ok;	// success
+}
+
+static int IXDEC_NAME(do_decode)(struct ix_icode_t *dest, U1 num_bytes, U1 *buf, struct ix_decoder_state_t *state_out)
+{
+	int status = crudasm_intel_status_internal_error;
+	struct code_fetcher_t fetcher;
+	struct decode_prefix_state_t p;
+	
+	if(num_bytes == 0)
+		return crudasm_intel_status_empty_buffer;
+	
+	fetcher.buf = buf;
+	fetcher.bytes_left = num_bytes;
+	fetcher.next_offset = 0;
+	
+	if(!IXDEC_NAME(fetch_prefixes)(&fetcher, &p))
+		return crudasm_intel_status_limit_exceeded;
+
+	
+	// - Try to decode.
+	// - If there's an error:
+	//   - If wait was used:
+	//     - match the "wait" instruction, itself (at p.wait_offset, as
+	//       fetch_prefixes() found it, with any prefixes discarded).
+	//   - If wait was not used:
+	//     - Return the error.
+	// - If there was no error:
+	//   - If wait was used:
+	//     - The insn is waitable (try_decode() fails otherwise),
+	//       return success
+	//   - If wait was not used:
+	//     - return success, unless insn length > 15 bytes,
+	//       in which case we want to return an error
+	
+	status = IXDEC_NAME(try_decode)(&fetcher, dest, &p, state_out);
+	dest->fwait = 0;  // not fwaitable
+	
+	if(status != crudasm_intel_status_ok)
+	{
+		if(p.wait_used)
+		{
+			// match wait, itself. discard any prefixes, including any after it.
+			return IXDEC_NAME(decode_fwait)(dest, buf, p.wait_offset, state_out);
+		}
+		
+		return status;
+	}
+	
+	// Decode was successful.
+	if(p.wait_used)
+	{
+		// wait was used, and it is waitable.
+		dest->fwait = 2;  // fwaitable (fwait WAS used)
+	}
+	else
+	{
+		if(state_out->insn_size > 15)
+			return crudasm_intel_status_too_long;
+		if(crudasm_intel_encoding_hot_table[dest->encoding].itags & crudasm_intel_itag_fwaitable)
+			dest->fwait = 1;  // fwaitable (fwait not used)
+	}
+	
+	return status;
+}
+
@@ -3,40 +3,201 @@
 
 #include "ixdisasm.h"
 #include <stdio.h>
+#include <string.h>
 
 struct crudasm_intel_disasm_context_t
 {
 	struct ix_icode_t *icode;
 	U8 rel;
-	char *dest;
+	struct crudasm_intel_disasm_sink_t *sink;
 	const char *imm;
 	const char *disp;
-	struct crudasm_intel_insn_t *insn;
-	struct crudasm_intel_encoding_t *encoding;
+	const struct crudasm_intel_insn_t *insn;
+	const struct crudasm_intel_encoding_t *encoding;
 	U1 dsz;
+	size_t start;	// sink->pos where this instruction's text begins
+	struct crudasm_intel_disasm_token_t *tokens;	// NULL if not wanted
+	size_t max_tokens;
+	size_t num_tokens;
+	U8 token_value;	// value for the token of the argument being written
+	U1 token_arg;	// argument being written
 };
 
+// Returns nonzero if sink has room for size more bytes, growing it if it can.
+static int ixdis_sink_room(struct crudasm_intel_disasm_sink_t *sink, size_t size)
+{
+	if(sink->size - sink->pos >= size)
+		return 1;
+	return sink->grow != NULL && sink->grow(sink, size) && sink->size - sink->pos >= size;
+}
+
+// Appends size bytes, or as many of them as fit.
+static void ixdis_sink_write(struct crudasm_intel_disasm_sink_t *sink, const char *msg, size_t size)
+{
+	if(!ixdis_sink_room(sink, size))
+	{
+		size = sink->size - sink->pos;
+		sink->truncated = 1;
+	}
+	memcpy(sink->buf + sink->pos, msg, size);
+	sink->pos += size;
+}
+
+// Writes value in lower case hex, zero padded to at least digits digits (like "%0*x").
+static void ixdis_sink_write_hex(struct crudasm_intel_disasm_sink_t *sink, U4 value, int digits)
+{
+	static const char hex[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+	char buf[8];
+	int i = 8;
+	do
+	{
+		buf[--i] = hex[value & 0xf];
+		value >>= 4;
+	}	while(value != 0 || 8 - i < digits);
+	ixdis_sink_write(sink, buf + i, 8 - i);
+}
+
+static void ixdis2_write_n(struct crudasm_intel_disasm_context_t *context, const char *msg, size_t size)
+{
+	ixdis_sink_write(context->sink, msg, size);
+}
+
 static void ixdis1_write(struct crudasm_intel_disasm_context_t *context, const char *msg)
 {
-	context->dest += sprintf(context->dest, "%s", msg);
+	struct crudasm_intel_disasm_sink_t *sink = context->sink;
+	size_t pos = sink->pos;
+	while(*msg != '\0')
+	{
+		if(pos == sink->size)
+		{
+			sink->pos = pos;
+			if(!ixdis_sink_room(sink, 1))
+			{
+				sink->truncated = 1;
+				return;
+			}
+		}
+		sink->buf[pos++] = *msg++;
+	}
+	sink->pos = pos;
+}
+
+// Token text is padded to sizeof(text) bytes, so when there's room we copy all
+// of it (a fixed size copy, not a call) and only keep the first length bytes.
+static void ixdis2_write_token_text(struct crudasm_intel_disasm_context_t *context, const struct crudasm_intel_token_t *token)
+{
+	struct crudasm_intel_disasm_sink_t *sink = context->sink;
+	if(sink->size - sink->pos >= sizeof(token->text))
+	{
+		memcpy(sink->buf + sink->pos, token->text, sizeof(token->text));
+		sink->pos += token->length;
+	}
+	else
+		ixdis2_write_n(context, token->text, token->length);
+}
+
+static void ixdis1_write_token(struct crudasm_intel_disasm_context_t *context, U4 token)
+{
+	ixdis2_write_token_text(context, crudasm_intel_tokens + token);
+}
+
+// Starts a structured token at the current position. Returns its index for
+// ixdis3_end_token(), or -1 if tokens aren't wanted or there's no room left.
+static int ixdis2_begin_token(struct crudasm_intel_disasm_context_t *context, U1 kind, U1 arg)
+{
+	struct crudasm_intel_disasm_token_t *token;
+	if(context->tokens == NULL || context->num_tokens == context->max_tokens)
+		return -1;
+	token = context->tokens + context->num_tokens;
+	token->value = 0;
+	token->offset = (U2)(context->sink->pos - context->start);
+	token->length = 0;
+	token->kind = kind;
+	token->arg = arg;
+	return (int)(context->num_tokens++);
+}
+
+// Ends a token started by ixdis2_begin_token(). Trailing spaces aren't part of it.
+static void ixdis3_end_token(struct crudasm_intel_disasm_context_t *context, int index, U8 value)
+{
+	struct crudasm_intel_disasm_token_t *token;
+	size_t end = context->sink->pos;
+	if(index < 0)
+		return;
+	token = context->tokens + index;
+	while(end > context->start + token->offset && context->sink->buf[end - 1] == ' ')
+		--end;
+	token->length = (U2)(end - context->start - token->offset);
+	token->value = value;
+}
+
+static void ixdis1_write_prefix(struct crudasm_intel_disasm_context_t *context, U4 token)
+{
+	int index = ixdis2_begin_token(context, crudasm_intel_disasm_token_prefix, crudasm_intel_disasm_token_no_arg);
+	ixdis1_write_token(context, token);
+	ixdis3_end_token(context, index, 0);
+}
+
+// Writes a register name from crudasm_intel_tokens[] as a register token of the current argument.
+static void ixdis2_write_reg(struct crudasm_intel_disasm_context_t *context, U4 token, U1 value)
+{
+	int index = ixdis2_begin_token(context, crudasm_intel_disasm_token_register, context->token_arg);
+	ixdis1_write_token(context, token + value);
+	ixdis3_end_token(context, index, value);
+}
+
+static void ixdis2_write_hex(struct crudasm_intel_disasm_context_t *context, U4 value, int digits)
+{
+	ixdis_sink_write_hex(context->sink, value, digits);
+}
+
+// Writes "0x" and then value, as ixdis2_write_hex() does.
+static void ixdis2_write_0x(struct crudasm_intel_disasm_context_t *context, U4 value, int digits)
+{
+	ixdis2_write_n(context, "0x", 2);
+	ixdis2_write_hex(context, value, digits);
+}
+
+static void ixdis1_write_dec(struct crudasm_intel_disasm_context_t *context, U4 value)
+{
+	char buf[10];
+	int i = 10;
+	do
+	{
+		buf[--i] = (char)('0' + value % 10);
+		value /= 10;
+	}	while(value != 0);
+	ixdis2_write_n(context, buf + i, 10 - i);
 }
 
 static void ixdis0_space(struct crudasm_intel_disasm_context_t *context)
 {
-	ixdis1_write(context, " ");
+	ixdis2_write_n(context, " ", 1);
 }
 
 static void ixdis0_comma(struct crudasm_intel_disasm_context_t *context)
 {
-	ixdis1_write(context, ",");
+	ixdis2_write_n(context, ",", 1);
+}
+
+// Writes register value of a crudasm_intel_tokens[] group of 16, i.e. xmm, mm,
+// cr, dr or st.
+static void do_write_reg_group(struct crudasm_intel_disasm_context_t *context, U4 group, U1 value)
+{
+	if(value <= 15)
+		ixdis1_write_token(context, group + value);
+	else
+	{
+		ixdis2_write_n(context, crudasm_intel_tokens[group].text, crudasm_intel_tokens[group].length - 1);
+		ixdis1_write_dec(context, value);
+	}
 }
 
 static void do_write_seg_reg(struct crudasm_intel_disasm_context_t *context, U1 value)
 {
-	const char *mysreg[8] = {"es", "cs", "ss", "ds", "fs", "gs", "ss", "ds"};
 	if(value < 8)
 	{
-		ixdis1_write(context, mysreg[value]);
+		ixdis1_write_token(context, crudasm_intel_token_sreg + value);
 	}
 	else
 		ixdis1_write(context, "<unknown seg reg>");
@@ -47,22 +208,22 @@ void ixdis1_write_asm_size(struct crudasm_intel_disasm_context_t *context, U4 s)
 	switch(s)
 	{
 		case 2:
-			ixdis1_write(context, "word");
+			ixdis1_write_token(context, crudasm_intel_token_word);
 			break;
 		case 4:
-			ixdis1_write(context, "dword");
+			ixdis1_write_token(context, crudasm_intel_token_dword);
 			break;
 		case 8:
-			ixdis1_write(context, "qword");
+			ixdis1_write_token(context, crudasm_intel_token_qword);
 			break;
 		case 16:
-			ixdis1_write(context, "xword");
+			ixdis1_write_token(context, crudasm_intel_token_xword);
 			break;
 		case 10:
-			ixdis1_write(context, "tword");	// is this right ?
+			ixdis1_write_token(context, crudasm_intel_token_tword);	// is this right ?
 			break;
 		case 1:
-			ixdis1_write(context, "byte");
+			ixdis1_write_token(context, crudasm_intel_token_byte);
 			break;
 		default:
 			ixdis1_write(context, "<unsupported size>");
@@ -73,16 +234,19 @@ void ixdis1_write_asm_size(struct crudasm_intel_disasm_context_t *context, U4 s)
 static void do_write_imm(struct crudasm_intel_disasm_context_t *context, U4 size, U8 imm_value)
 {
 	if(size == 1)
-		context->dest += sprintf(context->dest, "0x%02x", (U4)(U1)(imm_value));
+		ixdis2_write_0x(context, (U4)(U1)(imm_value), 2);
 	else
 	if(size == 2)
-		context->dest += sprintf(context->dest, "0x%04x", (U4)(U2)(imm_value));
+		ixdis2_write_0x(context, (U4)(U2)(imm_value), 4);
 	else
 	if(size == 4)
-		context->dest += sprintf(context->dest, "0x%08x", ((U4)(imm_value)));
+		ixdis2_write_0x(context, (U4)(imm_value), 8);
 	else
 	if(size == 8)
-		context->dest += sprintf(context->dest, "0x%08x%08x", ((U4)((imm_value >> 16) >> 16)), ((U4)(imm_value)));
+	{
+		ixdis2_write_0x(context, (U4)((imm_value >> 16) >> 16), 8);
+		ixdis2_write_hex(context, (U4)(imm_value), 8);
+	}
 	else
 		ixdis1_write(context, "<unsupported immediate size>");
 }
@@ -91,74 +255,42 @@ static void write_seg_reg(struct crudasm_intel_disasm_context_t *context, int wi
 {
 	if(context->icode->ea.sreg <= 5)
 	{
-		do_write_seg_reg(context, context->icode->ea.sreg);
+		ixdis2_write_reg(context, crudasm_intel_token_sreg, context->icode->ea.sreg);
 		if(with_space)
-			ixdis1_write(context, " ");
+			ixdis2_write_n(context, " ", 1);
 	}
 }
 
-static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int arg, int need_size, int xoverride, int no_short)
+static void do_write_arg(struct crudasm_intel_disasm_context_t *context, int arg, int need_size, int xoverride, int no_short)
 {
-	struct crudasm_intel_insn_t *insn = context->insn;
-	struct crudasm_intel_encoding_t *encoding = context->encoding;
+	const struct crudasm_intel_insn_t *insn = context->insn;
+	const struct crudasm_intel_encoding_t *encoding = context->encoding;
 	struct ix_icode_t *icode = context->icode;
 	
-	// Note: regs8[16..19] are used only by implict registers, if the user wants to specify AH, CH, DH, or BH.
-	const char *regs8x86[8] = {"al", "cl", "dl", "bl", "ah", "ch", "dh", "bh"};
-	const char *regs8[20] =  { "al",  "cl",  "dl",  "bl", "spl", "bpl", "sil", "dil", "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b", "ah", "ch", "dh", "bh"};
-	const char *regs16[16] = { "ax",  "cx",  "dx",  "bx",  "sp",  "bp",  "si",  "di", "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w"};
-	const char *regs32[16] = {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi", "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d"};
-	const char *regs64[16] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",  "r8",  "r9",  "r10",  "r11",  "r12",  "r13",  "r14",  "r15"};
+	// Note: crudasm_intel_token_reg8 + 16..19 are used only by implict registers, if the user wants to specify AH, CH, DH, or BH.
 
 	U1 argtype = icode->argtype[arg];
 	S1 argsize = icode->argsize[arg];
 	U1 argvalue = icode->argvalue[arg];
 	
-	S1 proto_size;
-	int i;
-	S1 proto2;
 	U8 ival;
 	int did_near, relative, did_plus;
-	const char *base, *index;
+	U4 regs, base, index;
 	int need_plus, needzero;
 	int iszero;
 	U8 dispval, newval;
 	U4 mydisp;
-	const char *plus;
+	size_t plus;
 
 	if(argtype >= 0x80)
 		ixdis1_write(context, "<unimpl-arg>");
 	else
 	{
-		proto_size = insn->argSizes[arg];
-
-		if(proto_size < 0)
-		{
-			// e.g. insn mov(P x, P y).
-			// Here, cur arg may have a parameterized size (P in this case)
-			// and another arg might have same size. If that other arg's
-			// size is known, then set mem_need_size to false.
-
-			for(i = 0; i < insn->numArgs; ++i)
-			{
-				if(i == arg)
-					continue;
-				proto2 = insn->argSizes[i];
-				if(proto2 == proto_size)
-				{
-					if(icode->argsize[i] > 0)
-					{
-						if(!crudasm_intel_argtype__is_imm(icode->argtype[i]))
-						{
-							// Immediate sizes don't "count".
-							need_size = 0;
-							break;
-						}
-					}
-				}
-			}
-		}
-		else
+		// e.g. insn mov(P x, P y). Here, cur arg may have a parameterized
+		// size (P in this case) and another arg might have same size. If that
+		// other arg isn't an immediate, its size says what this one is. makecpu
+		// works this out for each encoding.
+		if(crudasm_intel_argsize_index[icode->encoding] & (crudasm_intel_argsize_implied << arg))
 			need_size = 0;
 
 		if(xoverride)
@@ -174,56 +306,64 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 						if(encoding->argvalue[arg] == crudasm_intel_argvalue_default || encoding->argvalue[arg] == crudasm_intel_argvalue_reg_or_mem/*bug fix 10-12-2012*/)
 						{
 							if(icode->rex_used)
-								ixdis1_write(context, (argvalue <= 15) ? regs8[argvalue] : "<bad-reg-arg-1>");
+							{
+								if(argvalue <= 15)
+									ixdis1_write_token(context, crudasm_intel_token_reg8 + argvalue);
+								else
+									ixdis1_write(context, "<bad-reg-arg-1>");
+							}
+							else
+							if(argvalue <= 7)
+								ixdis1_write_token(context, crudasm_intel_token_reg8x86 + argvalue);
 							else
-								ixdis1_write(context, (argvalue <= 7) ? regs8x86[argvalue] : "<bad-reg-arg-2>");
+								ixdis1_write(context, "<bad-reg-arg-2>");
 						}
 						else
 						{
 							// Implict argument.
-							ixdis1_write(context, (argvalue <= 19) ? regs8[argvalue] : "<bad-reg-arg-3>");
+							if(argvalue <= 19)
+								ixdis1_write_token(context, crudasm_intel_token_reg8 + argvalue);
+							else
+								ixdis1_write(context, "<bad-reg-arg-3>");
 						}
 					}
 					else
 					if(argvalue <= 15)
 					{
 						if(argsize == 2)
-							ixdis1_write(context, regs16[argvalue]);
+							ixdis1_write_token(context, crudasm_intel_token_reg16 + argvalue);
 						else
 						if(argsize == 4)
-							ixdis1_write(context, regs32[argvalue]);
+							ixdis1_write_token(context, crudasm_intel_token_reg32 + argvalue);
 						else
 						if(argsize == 8)
-							ixdis1_write(context, regs64[argvalue]);
+							ixdis1_write_token(context, crudasm_intel_token_reg64 + argvalue);
 						else
 							ixdis1_write(context, "<bad-reg-arg-4>");
 					}
 					else
 					{
 						ixdis1_write(context, "<bad-reg-arg-5>");
-						context->dest += sprintf(context->dest, "(%x)", argvalue);
+						ixdis2_write_n(context, "(", 1);
+						ixdis2_write_hex(context, argvalue, 1);
+						ixdis2_write_n(context, ")", 1);
 					}
 
 					return;
 				case crudasm_intel_argtype_reg_xmm:
-					ixdis1_write(context, "xmm");
-					context->dest += sprintf(context->dest, "%d", argvalue);
+					do_write_reg_group(context, crudasm_intel_token_xmm, argvalue);
 					return;
 				case crudasm_intel_argtype_reg_mmx:
-					ixdis1_write(context, "mm");
-					context->dest += sprintf(context->dest, "%d", argvalue);
+					do_write_reg_group(context, crudasm_intel_token_mmx, argvalue);
 					return;
 				case crudasm_intel_argtype_reg_dr:
-					ixdis1_write(context, "dr");
-					context->dest += sprintf(context->dest, "%d", argvalue);
+					do_write_reg_group(context, crudasm_intel_token_dr, argvalue);
 					return;
 				case crudasm_intel_argtype_reg_cr:
-					ixdis1_write(context, "cr");
-					context->dest += sprintf(context->dest, "%d", argvalue);
+					do_write_reg_group(context, crudasm_intel_token_cr, argvalue);
 					return;
 				case crudasm_intel_argtype_reg_st:
-					ixdis1_write(context, "st");
-					context->dest += sprintf(context->dest, "%d", argvalue);
+					do_write_reg_group(context, crudasm_intel_token_st, argvalue);
 					return;
 				case crudasm_intel_argtype_reg_sr:
 					do_write_seg_reg(context, argvalue);
@@ -265,16 +405,22 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 				if(relative)
 				{
 					if(!no_short)
-						ixdis1_write(context, "short ");
+						ixdis1_write_token(context, crudasm_intel_token_short);
 				}
 				else
-					ixdis1_write(context, "byte ");
+				{
+					ixdis1_write_token(context, crudasm_intel_token_byte);
+					ixdis2_write_n(context, " ", 1);
+				}
 			}
 			else
 			if(need_size)
 			{
 				if(argsize != 8 && !(encoding->etags & crudasm_intel_etag_imm64_sx32))
+				{
 					ixdis1_write_asm_size(context, argsize);
+					ixdis2_write_n(context, " ", 1);
+				}
 				else
 				{
 					// NOTE: nasm refuses to accept 'jo dword $$+0x12345678' in 64bit mode.
@@ -284,15 +430,32 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 					// produce code that will reasonably be expected to reassemble.
 					if(relative)
 					{
-						ixdis1_write(context, "near");
+						ixdis1_write_token(context, crudasm_intel_token_near);
 						did_near = 1;
 					}
 					else
+					{
 						ixdis1_write_asm_size(context, 2 << icode->osz);	/* was hardwired to 4 */
+						ixdis2_write_n(context, " ", 1);
+					}
 				}
-				ixdis1_write(context, " ");
 			}
 			
+			if(relative)
+			{
+				ival += context->rel;
+
+				if(context->dsz != 2)
+				{
+					if(icode->osz == 0)
+						ival &= TULL(0xffff);
+					else
+					if(icode->osz == 1)
+						ival &= TULL(0xffffffff);
+				}
+			}
+			context->token_value = ival;
+
 			if(context->imm != NULL)
 			{
 				ixdis1_write(context, context->imm);
@@ -304,34 +467,25 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 			if(relative)
 			{
 				if(!icode->sx && !did_near)
-					ixdis1_write(context, "near ");
+					ixdis1_write_token(context, crudasm_intel_token_near);
 
-				ixdis1_write(context, "$$+");
+				ixdis1_write_token(context, crudasm_intel_token_section_plus);
 				did_plus = 1;
-
-				ival += context->rel;
-
-				if(context->dsz != 2)
-				{
-					if(icode->osz == 0)
-						ival &= TULL(0xffff);
-					else
-					if(icode->osz == 1)
-						ival &= TULL(0xffffffff);
-				}
 			}
 
 			if(icode->sx && !relative)
 			{
 				if((ival & 0xff) < 0x80)
 				{
-					if(did_plus)
-						context->dest += sprintf(context->dest, "0x%02x", ((U4)(ival)) & 0xff);
-					else
-						context->dest += sprintf(context->dest, "+0x%02x", ((U4)(ival)) & 0xff);
+					if(!did_plus)
+						ixdis2_write_n(context, "+", 1);
+					ixdis2_write_0x(context, ((U4)(ival)) & 0xff, 2);
 				}
 				else
-					context->dest += sprintf(context->dest, "-0x%02x", 0x100 - (((U4)(ival)) & 0xff));
+				{
+					ixdis2_write_n(context, "-", 1);
+					ixdis2_write_0x(context, 0x100 - (((U4)(ival)) & 0xff), 2);
+				}
 			}
 			else
 			{
@@ -342,13 +496,15 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 					else
 					if(ival < TULL(0x80000000))
 					{
-						if(did_plus)
-							context->dest += sprintf(context->dest, "0x%08x", (U4)(ival));
-						else
-							context->dest += sprintf(context->dest, "+0x%08x", (U4)(ival));
+						if(!did_plus)
+							ixdis2_write_n(context, "+", 1);
+						ixdis2_write_0x(context, (U4)(ival), 8);
 					}
 					else
-						context->dest += sprintf(context->dest, "-0x%08x", (U4)(TULL(0x100000000) - (U8)(U4)(ival)));
+					{
+						ixdis2_write_n(context, "-", 1);
+						ixdis2_write_0x(context, (U4)(TULL(0x100000000) - (U8)(U4)(ival)), 8);
+					}
 				}
 				else
 					do_write_imm(context, argsize, ival);
@@ -365,32 +521,41 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 			if(need_size)
 			{
 				if(argsize == 10)
-					ixdis1_write(context, "tword ");
+				{
+					ixdis1_write_token(context, crudasm_intel_token_tword);
+					ixdis2_write_n(context, " ", 1);
+				}
 				else
 				if(argsize == 2 || argsize == 4 || argsize == 8)
 				{
 					ixdis1_write_asm_size(context, argsize);
-					ixdis1_write(context, " ");
+					ixdis2_write_n(context, " ", 1);
 					if(argtype == crudasm_intel_argtype_mem_ea && (insn->itags & crudasm_intel_itag_ctrlxfer))
-						ixdis1_write(context, "near ");
+						ixdis1_write_token(context, crudasm_intel_token_near);
 					else
 					if(argtype == crudasm_intel_argtype_mem_ea_seg && (insn->itags & crudasm_intel_itag_ctrlxfer))
-						ixdis1_write(context, "far ");
+						ixdis1_write_token(context, crudasm_intel_token_far);
 				}
 				else
 				if(argsize == 1)
-					ixdis1_write(context, "byte ");
+				{
+					ixdis1_write_token(context, crudasm_intel_token_byte);
+					ixdis2_write_n(context, " ", 1);
+				}
 				else
 					ixdis1_write(context, "<unsupported size> ");
 			}
 
-			ixdis1_write(context, "[");
+			ixdis2_write_n(context, "[", 1);
 			
 			if(icode->rip_relative != 0)
-				ixdis1_write(context, "rel ");
+				ixdis1_write_token(context, crudasm_intel_token_rel);
 
 			if(argtype == crudasm_intel_argtype_mem_fulldisp && icode->asz == 2 && (encoding->etags & crudasm_intel_etag_imm64_disp))
-				ixdis1_write(context, "qword ");
+			{
+				ixdis1_write_token(context, crudasm_intel_token_qword);
+				ixdis2_write_n(context, " ", 1);
+			}
 
 			needzero = 0;
 			if(icode->asz != context->dsz)
@@ -399,60 +564,45 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 				{
 					needzero = 1;
 					ixdis1_write_asm_size(context, 2 << icode->asz);
-					ixdis1_write(context, " ");
+					ixdis2_write_n(context, " ", 1);
 				}
 			}
 
 			if(icode->ea.sreg <= 5)
 			{
 				write_seg_reg(context, 0);
-				ixdis1_write(context, ":");
+				ixdis2_write_n(context, ":", 1);
 			}
 
 			// Now show registers and displacement in EA, itself.
-			base = NULL;
-			index = NULL;
-
 			if(icode->asz == 0)
-			{
-				if(icode->ea.base != 31)
-					base = regs16[icode->ea.base];
-				if(icode->ea.index != 31)
-					index = regs16[icode->ea.index];
-			}
+				regs = crudasm_intel_token_reg16;
 			else
 			if(icode->asz == 1)
-			{
-				if(icode->ea.base != 31)
-					base = regs32[icode->ea.base];
-				if(icode->ea.index != 31)
-					index = regs32[icode->ea.index];
-			}
+				regs = crudasm_intel_token_reg32;
 			else
-			{
-				if(icode->ea.base != 31)
-					base = regs64[icode->ea.base];
-				if(icode->ea.index != 31)
-					index = regs64[icode->ea.index];
-			}
+				regs = crudasm_intel_token_reg64;
+			base = icode->ea.base;
+			index = icode->ea.index;
 
 			need_plus = 0;
 
-			if(base != NULL)
+			if(base != 31)
 			{
-				ixdis1_write(context, base);
+				ixdis2_write_reg(context, regs, (U1)(base));
 				need_plus = 1;
 			}
 
-			if(index != NULL)
+			if(index != 31)
 			{
 				if(need_plus)
-					ixdis1_write(context, "+");
+					ixdis2_write_n(context, "+", 1);
 				need_plus = 1;
-				ixdis1_write(context, index);
+				ixdis2_write_reg(context, regs, (U1)(index));
 				if(icode->ea.index_scale != 0)
 				{
-					context->dest += sprintf(context->dest, "*%x", 1 << icode->ea.index_scale);
+					ixdis2_write_n(context, "*", 1);
+					ixdis2_write_hex(context, 1 << icode->ea.index_scale, 1);
 				}
 			}
 
@@ -460,21 +610,25 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 			if(context->disp != NULL)
 			{
 				if(need_plus)
-					ixdis1_write(context, "+");
+					ixdis2_write_n(context, "+", 1);
 				ixdis1_write(context, context->disp);
 			}
 			else
 			if(argtype != crudasm_intel_argtype_mem_fulldisp && icode->ea.disp8 != 0)
 			{
 				mydisp = icode->disp;
+				context->token_value = (U8)(S8)(S1)(U1)(mydisp);
 				if((mydisp & 0xff) < 0x80)
 				{
 					if(need_plus)
-						ixdis1_write(context, "+");
-					context->dest += sprintf(context->dest, "0x%02x", mydisp);
+						ixdis2_write_n(context, "+", 1);
+					ixdis2_write_0x(context, mydisp, 2);
 				}
 				else
-					context->dest += sprintf(context->dest, "-0x%02x", 0x100 - (mydisp & 0xff));
+				{
+					ixdis2_write_n(context, "-", 1);
+					ixdis2_write_0x(context, 0x100 - (mydisp & 0xff), 2);
+				}
 			}
 			else
 			if(argtype == crudasm_intel_argtype_mem_fulldisp || icode->has_disp != 0)
@@ -487,24 +641,41 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 					dispval += ((U8)(icode->imm) << 16) << 16;
 					iszero = dispval == 0;
 				}
+				context->token_value = dispval;
 				if(!iszero || argtype == crudasm_intel_argtype_mem_fulldisp || (icode->ea.index == 31 && icode->ea.base == 31))
 				{
-					plus = (need_plus) ? "+" : "";
+					plus = (need_plus) ? 1 : 0;
 					if(icode->asz == 0)
-						context->dest += sprintf(context->dest, "%s0x%04x", plus, (U4)(U2)(dispval));
+					{
+						ixdis2_write_n(context, "+", plus);
+						ixdis2_write_0x(context, (U4)(U2)(dispval), 4);
+					}
 					else
 					if(icode->asz == 1)
-						context->dest += sprintf(context->dest, "%s0x%08x", plus, (U4)(dispval));
+					{
+						ixdis2_write_n(context, "+", plus);
+						ixdis2_write_0x(context, (U4)(dispval), 8);
+					}
 					else
 					if(argtype == crudasm_intel_argtype_mem_fulldisp)
-						context->dest += sprintf(context->dest, "%s0x%08x%08x", plus, (U4)((dispval >> 16) >> 16), (U4)(dispval));
+					{
+						ixdis2_write_n(context, "+", plus);
+						ixdis2_write_0x(context, (U4)((dispval >> 16) >> 16), 8);
+						ixdis2_write_hex(context, (U4)(dispval), 8);
+					}
 					else
 					if(icode->rip_relative == 0)
 					{
 						if(dispval < TULL(0x80000000))
-							context->dest += sprintf(context->dest, "%s0x%08x", plus, (U4)(dispval));
+						{
+							ixdis2_write_n(context, "+", plus);
+							ixdis2_write_0x(context, (U4)(dispval), 8);
+						}
 						else
-							context->dest += sprintf(context->dest, "-0x%08x", (U4)(TULL(0x100000000) - (U8)(U4)(dispval)));
+						{
+							ixdis2_write_n(context, "-", 1);
+							ixdis2_write_0x(context, (U4)(TULL(0x100000000) - (U8)(U4)(dispval)), 8);
+						}
 					}
 					else
 					{
@@ -514,15 +685,20 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 							newval += (U8)(dispval);
 						else
 							newval -= (U8)(U4)(TULL(0x100000000) - (U8)(U4)(dispval));
+						context->token_value = newval;
+						ixdis2_write_n(context, "+", plus);
 						if(newval < TULL(0x100000000))
-							context->dest += sprintf(context->dest, "%s0x%x", plus, (U4)(newval));
+							ixdis2_write_0x(context, (U4)(newval), 1);
 						else
-							context->dest += sprintf(context->dest, "%s0x%x%08x", plus, (U4)((newval >> 16) >> 16), (U4)(newval));
+						{
+							ixdis2_write_0x(context, (U4)((newval >> 16) >> 16), 1);
+							ixdis2_write_hex(context, (U4)(newval), 8);
+						}
 					}
 				}
 			}
 
-			ixdis1_write(context, "]");
+			ixdis2_write_n(context, "]", 1);
 			return;
 		}	// end mem
 	}
@@ -530,6 +706,33 @@ static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int
 	ixdis1_write(context, "<unimplemented-argument>");
 }
 
+// Writes an argument, and its structured token if tokens are wanted.
+static void ixdis4_write_arg(struct crudasm_intel_disasm_context_t *context, int arg, int need_size, int xoverride, int no_short)
+{
+	U1 argtype = context->icode->argtype[arg];
+	int index = -1;
+
+	context->token_arg = (U1)(arg);
+	context->token_value = 0;
+	if(context->tokens != NULL && argtype < 0x80)
+	{
+		if(crudasm_intel_argtype__is_reg(argtype))
+		{
+			index = ixdis2_begin_token(context, crudasm_intel_disasm_token_register, (U1)(arg));
+			context->token_value = context->icode->argvalue[arg];
+		}
+		else
+		if(crudasm_intel_argtype__is_imm(argtype))
+			index = ixdis2_begin_token(context, (context->encoding->etags & crudasm_intel_etag_relative) ?
+				crudasm_intel_disasm_token_target : crudasm_intel_disasm_token_immediate, (U1)(arg));
+		else
+		if(crudasm_intel_argtype__is_mem(argtype))
+			index = ixdis2_begin_token(context, crudasm_intel_disasm_token_memory, (U1)(arg));
+	}
+	do_write_arg(context, arg, need_size, xoverride, no_short);
+	ixdis3_end_token(context, index, context->token_value);
+}
+
 static void ixdis3_write_arg(struct crudasm_intel_disasm_context_t *context, int arg, int need_size, int xoverride)
 {
 	ixdis4_write_arg(context, arg, need_size, xoverride, 0);
@@ -579,16 +782,16 @@ static void ixdis1_maybe_write_space_args_imm32(struct crudasm_intel_disasm_cont
 static void ixdis0_write_rep(struct crudasm_intel_disasm_context_t *context)
 {
 	if(context->icode->lockrep == 2 || context->icode->lockrep == 3)
-		ixdis1_write(context, "rep ");
+		ixdis1_write_prefix(context, crudasm_intel_token_rep);
 }
 
 static void ixdis0_write_repcc(struct crudasm_intel_disasm_context_t *context)
 {
 	if(context->icode->lockrep == 2)
-		ixdis1_write(context, "repnz ");
+		ixdis1_write_prefix(context, crudasm_intel_token_repnz);
 	else
 	if(context->icode->lockrep == 3)
-		ixdis1_write(context, "repz ");
+		ixdis1_write_prefix(context, crudasm_intel_token_repz);
 }
 
 static void ixdis1_write_size_suffix(struct crudasm_intel_disasm_context_t *context, U1 size)
@@ -596,19 +799,19 @@ static void ixdis1_write_size_suffix(struct crudasm_intel_disasm_context_t *cont
 	switch(size)
 	{
 	case 2:
-		ixdis1_write(context, "w");
+		ixdis2_write_n(context, "w", 1);
 		break;
 	case 4:
-		ixdis1_write(context, "d");
+		ixdis2_write_n(context, "d", 1);
 		break;
 	case 8:
-		ixdis1_write(context, "q");
+		ixdis2_write_n(context, "q", 1);
 		break;
 	case 16:
-		ixdis1_write(context, "x");
+		ixdis2_write_n(context, "x", 1);
 		break;
 	case 1:
-		ixdis1_write(context, "b");
+		ixdis2_write_n(context, "b", 1);
 		break;
 	default:
 		ixdis1_write(context, "<unknown size>");
@@ -628,28 +831,31 @@ static void ixdis0_write_size_suffix_osz(struct crudasm_intel_disasm_context_t *
 
 static void ixdis0_write_seg_reg(struct crudasm_intel_disasm_context_t *context)
 {
+	int index;
 	if(context->icode->ea.sreg <= 5)
 	{
+		index = ixdis2_begin_token(context, crudasm_intel_disasm_token_prefix, crudasm_intel_disasm_token_no_arg);
 		do_write_seg_reg(context, context->icode->ea.sreg);
-		ixdis1_write(context, " ");
+		ixdis3_end_token(context, index, context->icode->ea.sreg);
+		ixdis2_write_n(context, " ", 1);
 	}
 }
 
-// write the 1st argument if osz is 64 bits, else write 2nd argument.
-static void ixdis2_write_osz64(struct crudasm_intel_disasm_context_t *context, const char *arg0, const char *arg1)
+// write token + 1 if osz is 64 bits, else write token.
+static void ixdis1_write_osz64(struct crudasm_intel_disasm_context_t *context, U4 token)
 {
-	ixdis1_write(context, (context->icode->osz == 2) ? arg0 : arg1);
+	ixdis1_write_token(context, token + ((context->icode->osz == 2) ? 1 : 0));
 }
 
 static void ixdis0_write_o16_o32_o64(struct crudasm_intel_disasm_context_t *context)
 {
 	if(context->icode->osz == 0)
-		ixdis1_write(context, "o16 ");
+		ixdis1_write_prefix(context, crudasm_intel_token_o16);
 	else
 	if(context->icode->osz == 1)
-		ixdis1_write(context, "o32 ");
+		ixdis1_write_prefix(context, crudasm_intel_token_o32);
 	else
-		ixdis1_write(context, "o64 ");
+		ixdis1_write_prefix(context, crudasm_intel_token_o64);
 }
 
 static void ixdis0_write_stack_o16_o32_o64(struct crudasm_intel_disasm_context_t *context)
@@ -658,7 +864,7 @@ static void ixdis0_write_stack_o16_o32_o64(struct crudasm_intel_disasm_context_t
 	{
 		// 64bit mode.
 		if(context->icode->osz == 0)
-			ixdis1_write(context, "o16 ");
+			ixdis1_write_prefix(context, crudasm_intel_token_o16);
 	}
 	else
 	if(context->dsz != context->icode->osz)
@@ -667,13 +873,13 @@ static void ixdis0_write_stack_o16_o32_o64(struct crudasm_intel_disasm_context_t
 	}
 }
 
-static void ixdis3_do_nop_xchg(struct crudasm_intel_disasm_context_t *context, const char *nop, const char *xchg, int argnum)
+static void ixdis3_do_nop_xchg(struct crudasm_intel_disasm_context_t *context, U4 nop, U4 xchg, int argnum)
 {
 	if(context->icode->argvalue[argnum] == 0 && context->icode->is_nop && context->icode->argtype[0] == crudasm_intel_argtype_reg_gr)
-		ixdis1_write(context, nop);
+		ixdis1_write_token(context, nop);
 	else
 	{
-		ixdis1_write(context, xchg);
+		ixdis1_write_token(context, xchg);
 		ixdis0_space(context);
 		ixdis0_write_args(context);
 	}
@@ -694,32 +900,16 @@ static void ixdis0_write_xlat_o16_o32_o64(struct crudasm_intel_disasm_context_t
 	}
 }
 
-// if osz == 0, write 1st argument.
-// if osz == 1, write 2nd argument.
-// if osz == 2, write 3rd argument.
-static void ixdis3_write_osz(struct crudasm_intel_disasm_context_t *context, const char *arg0, const char *arg1, const char *arg2)
+// write token + osz, i.e. the 16, 32 or 64 bit form.
+static void ixdis1_write_osz(struct crudasm_intel_disasm_context_t *context, U4 token)
 {
-	if(context->icode->osz == 0)
-		ixdis1_write(context, arg0);
-	else
-	if(context->icode->osz == 1)
-		ixdis1_write(context, arg1);
-	else
-		ixdis1_write(context, arg2);
+	ixdis1_write_token(context, token + context->icode->osz);
 }
 
-// if asz == 0, write 1st argument.
-// if asz == 1, write 2nd argument.
-// if asz == 2, write 3rd argument.
-static void ixdis3_write_asz(struct crudasm_intel_disasm_context_t *context, const char *arg0, const char *arg1, const char *arg2)
+// write token + asz, i.e. the 16, 32 or 64 bit form.
+static void ixdis1_write_asz(struct crudasm_intel_disasm_context_t *context, U4 token)
 {
-	if(context->icode->asz == 0)
-		ixdis1_write(context, arg0);
-	else
-	if(context->icode->asz == 1)
-		ixdis1_write(context, arg1);
-	else
-		ixdis1_write(context, arg2);
+	ixdis1_write_token(context, token + context->icode->asz);
 }
 
 static void ixdis0_write_jrcxz_o16_o32_o64(struct crudasm_intel_disasm_context_t *context)
@@ -733,13 +923,19 @@ static void ixdis0_write_jrcxz_o16_o32_o64(struct crudasm_intel_disasm_context_t
 
 static void ixdis0_write_far_imm(struct crudasm_intel_disasm_context_t *context)
 {
+	int index;
+
 	// This is not used in 64bit mode.
 	ixdis1_write_asm_size(context, 2 << context->icode->osz);
 	//write(" far ");
-	ixdis1_write(context, " ");
+	ixdis2_write_n(context, " ", 1);
+	index = ixdis2_begin_token(context, crudasm_intel_disasm_token_immediate, 1);
 	do_write_imm(context, context->icode->argsize[1], (U4)(U2)(context->icode->disp));
-	ixdis1_write(context, ":");
+	ixdis3_end_token(context, index, (U2)(context->icode->disp));
+	ixdis2_write_n(context, ":", 1);
+	index = ixdis2_begin_token(context, crudasm_intel_disasm_token_immediate, 0);
 	do_write_imm(context, context->icode->argsize[0], context->icode->imm);
+	ixdis3_end_token(context, index, context->icode->imm);
 }
 
 static void ixdis1_maybe_write_oxx(struct crudasm_intel_disasm_context_t *context, U1 dsz)
@@ -767,54 +963,191 @@ static void ixdis1_maybe_write_oxx(struct crudasm_intel_disasm_context_t *contex
 #include "intel_disasm_nasm.h"
 #include "../generated/out_intel_disasm_nasm.h"
 
-void crudasm_intel_disasm(struct ix_icode_t *icode, U8 rel, char *destT, const char *immT, const char *dispT, U1 dsz)
+// Adds the mnemonic's token, which nothing marks while writing it (the special
+// cases in intel_disasm_nasm.h write it as part of whatever they write). It's
+// the word after any prefixes.
+static void ixdis0_add_mnemonic_token(struct crudasm_intel_disasm_context_t *context)
 {
-	struct crudasm_intel_disasm_context_t context;
-	const char *s;
-	
-	destT[0] = '\0';
-	
-	if(icode->encoding == 0xffffffff)
+	struct crudasm_intel_disasm_token_t *tokens = context->tokens;
+	const char *text = context->sink->buf + context->start;
+	size_t length = context->sink->pos - context->start;
+	size_t first = 0, begin = 0, end;
+
+	while(first < context->num_tokens && tokens[first].kind == crudasm_intel_disasm_token_prefix)
 	{
-		// Don't try to disassemble invalid opcodes.
-		return;
+		begin = (size_t)(tokens[first].offset) + tokens[first].length;
+		++first;
 	}
-	
-	context.icode = icode;
-	context.rel = rel;
-	context.dest = destT;
-	context.imm = immT;
-	context.disp = dispT;
-	context.dsz = dsz;
-	context.insn = crudasm_intel_insns + (size_t)(crudasm_intel_encoding_table[icode->encoding].insn);
-	context.encoding = crudasm_intel_encoding_table + icode->encoding;
+	while(begin < length && text[begin] == ' ')
+		++begin;
+	for(end = begin; end < length && text[end] != ' '; ++end)
+		;
+	if(end == begin || first == context->max_tokens)
+		return;
+	if(context->num_tokens == context->max_tokens)
+		--context->num_tokens;		// the last token gives way
+	memmove(tokens + first + 1, tokens + first, (context->num_tokens - first) * sizeof(struct crudasm_intel_disasm_token_t));
+	++context->num_tokens;
+	tokens[first].value = 0;
+	tokens[first].offset = (U2)(begin);
+	tokens[first].length = (U2)(end - begin);
+	tokens[first].kind = crudasm_intel_disasm_token_mnemonic;
+	tokens[first].arg = crudasm_intel_disasm_token_no_arg;
+}
+
+// Writes context->icode, which is valid. Everything in context that doesn't
+// depend on the instruction must already be set up.
+static void ixdis0_disasm_icode(struct crudasm_intel_disasm_context_t *context)
+{
+	struct ix_icode_t *icode = context->icode;
+	const struct crudasm_intel_token_t *alias;
+
+	context->encoding = crudasm_intel_encoding_table + icode->encoding;
+	context->insn = crudasm_intel_insns + (size_t)(context->encoding->insn);
+	context->start = context->sink->pos;
+	context->num_tokens = 0;
+	context->token_value = 0;
+	context->token_arg = 0;
 	
 	if(icode->lockrep == 1)
-		ixdis1_write(&context, "lock ");
+		ixdis1_write_prefix(context, crudasm_intel_token_lock);
 	if(icode->fwait == 2)  /* fwait used, is fwaitable */
-		ixdis1_write(&context, "f");
+		ixdis2_write_n(context, "f", 1);
 	else
 	if(icode->fwait == 1)  /* fwait not used, but is fwaitable */
-		ixdis1_write(&context, "fn");
+		ixdis2_write_n(context, "fn", 2);
 	
-	if(!crudasm_intel_disasm_special_nasm(&context, crudasm_intel_encoding_table[icode->encoding].insn))
+	if(!crudasm_intel_disasm_special_nasm(context, context->encoding->insn))
 	{
 		// No special handling for this instruction. Do a default disassembly.
 
 		// print o16/o32/o64 if needed.
-		ixdis1_maybe_write_oxx(&context, dsz);
-		if(icode->fwait == 1 || icode->fwait == 2)
+		ixdis1_maybe_write_oxx(context, context->dsz);
+		alias = crudasm_intel_insn_tokens + context->encoding->insn;
+		if((icode->fwait == 1 || icode->fwait == 2) && alias->length >= 2 && alias->text[0] == '_' && alias->text[1] == 'f')
 		{
 			// fwait was used -- skip any "_f" prefix in alias name.
-			s = context.insn->alias;
-			if(s[0] == '_' && s[1] == 'f')
-				s += 2;
-			ixdis1_write(&context, s);
+			ixdis2_write_n(context, alias->text + 2, alias->length - 2);
 		}
 		else
-			ixdis1_write(&context, context.insn->alias);
-		ixdis0_write_any_args(&context);
+			ixdis2_write_token_text(context, alias);
+		ixdis0_write_any_args(context);
 	}
+
+	if(context->tokens != NULL)
+		ixdis0_add_mnemonic_token(context);
+}
+
+int crudasm_intel_disasm_tokens(struct crudasm_intel_disasm_sink_t *sink, struct ix_icode_t *icode, U8 rel, const char *immT, const char *dispT, U1 dsz,
+	struct crudasm_intel_disasm_token_t *tokens, size_t max_tokens, size_t *num_tokens)
+{
+	struct crudasm_intel_disasm_context_t context;
+	size_t start = sink->pos;
+	int truncated = sink->truncated;
+	
+	if(num_tokens != NULL)
+		*num_tokens = 0;
+	if(icode->encoding == 0xffffffff)
+	{
+		// Don't try to disassemble invalid opcodes.
+		return 0;
+	}
+	
+	sink->truncated = 0;
+	context.icode = icode;
+	context.rel = rel;
+	context.sink = sink;
+	context.tokens = tokens;
+	context.max_tokens = max_tokens;
+	context.imm = immT;
+	context.disp = dispT;
+	context.dsz = dsz;
+	ixdis0_disasm_icode(&context);
+
+	if(tokens != NULL && num_tokens != NULL)
+		*num_tokens = context.num_tokens;
+	if(sink->truncated)
+		return -1;
+	sink->truncated = truncated;
+	return (int)(sink->pos - start);
+}
+
+int crudasm_intel_disasm_sink(struct crudasm_intel_disasm_sink_t *sink, struct ix_icode_t *icode, U8 rel, const char *immT, const char *dispT, U1 dsz)
+{
+	return crudasm_intel_disasm_tokens(sink, icode, rel, immT, dispT, dsz, NULL, 0, NULL);
+}
+
+size_t crudasm_intel_disasm_batch(struct crudasm_intel_disasm_sink_t *sink, struct ix_icode_t *icodes, const U8 *rels, size_t count, U1 dsz,
+	struct crudasm_intel_disasm_span_t *spans)
+{
+	struct crudasm_intel_disasm_context_t context;
+	int truncated = sink->truncated;
+	size_t i;
+
+	sink->truncated = 0;
+	context.sink = sink;
+	context.tokens = NULL;
+	context.max_tokens = 0;
+	context.imm = NULL;
+	context.disp = NULL;
+	context.dsz = dsz;
+	for(i = 0; i < count; ++i)
+	{
+		spans[i].offset = sink->pos;
+		if(icodes[i].encoding != 0xffffffff)
+		{
+			context.icode = icodes + i;
+			context.rel = rels[i];
+			ixdis0_disasm_icode(&context);
+			if(sink->truncated)
+			{
+				// Leave only whole instructions in the sink.
+				sink->pos = spans[i].offset;
+				return i;
+			}
+		}
+		spans[i].length = sink->pos - spans[i].offset;
+	}
+	sink->truncated = truncated;
+	return count;
+}
+
+void crudasm_intel_sink_write(struct crudasm_intel_disasm_sink_t *sink, const char *text, size_t size)
+{
+	ixdis_sink_write(sink, text, size);
+}
+
+void crudasm_intel_sink_write_hex(struct crudasm_intel_disasm_sink_t *sink, U4 value, int digits)
+{
+	ixdis_sink_write_hex(sink, value, digits);
+}
+
+int crudasm_intel_disasm_n(struct ix_icode_t *icode, U8 rel, char *destT, size_t dest_size, const char *immT, const char *dispT, U1 dsz)
+{
+	struct crudasm_intel_disasm_sink_t sink;
+	int result;
+	
+	if(dest_size == 0)
+		return -1;
+	sink.buf = destT;
+	sink.pos = 0;
+	sink.size = dest_size - 1;		// room for the '\0'
+	sink.grow = NULL;
+	sink.user = NULL;
+	sink.truncated = 0;
+	result = crudasm_intel_disasm_sink(&sink, icode, rel, immT, dispT, dsz);
+	destT[sink.pos] = '\0';
+	return result;
+}
+
+void crudasm_intel_disasm(struct ix_icode_t *icode, U8 rel, char *destT, const char *immT, const char *dispT, U1 dsz)
+{
+	size_t dest_size = 1024;
+	if(immT != NULL)
+		dest_size += strlen(immT);
+	if(dispT != NULL)
+		dest_size += strlen(dispT);
+	crudasm_intel_disasm_n(icode, rel, destT, dest_size, immT, dispT, dsz);
 }
 
 //===============================================================================================//
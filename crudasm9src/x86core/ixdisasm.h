@@ -12,13 +12,90 @@ extern "C"
 {
 #endif
 
-// destT should be an array of at least 1024 bytes + strlen(immT) + strlen(dispT), or longer.
+// Where crudasm_intel_disasm_sink() writes: a buffer of size bytes at buf, of which the first pos are in use.
+// Text goes at buf + pos, and pos is moved past it; no '\0' is written, though bytes after the new pos (but
+// before size) may be overwritten. If it doesn't fit and grow isn't NULL, grow is called to make room for
+// need more bytes. It may move the buffer (it must then update buf and size) and returns 0 if it can't.
+// Whatever still doesn't fit is cut off, and truncated is set.
+struct crudasm_intel_disasm_sink_t
+{
+	char *buf;
+	size_t pos;
+	size_t size;
+	int (*grow)(struct crudasm_intel_disasm_sink_t *sink, size_t need);
+	void *user;		// for grow
+	int truncated;
+};
+
+// Appends the disassembly of icode to sink. Returns the number of bytes appended, or -1 if it was cut short
+// (the part that fit is still there). The other arguments are as for crudasm_intel_disasm_n().
+int crudasm_intel_disasm_sink(struct crudasm_intel_disasm_sink_t *sink, struct ix_icode_t *icode, U8 rel, const char *immT, const char *dispT, U1 dsz);
+
+// A span of the text written by crudasm_intel_disasm_tokens(), saying what it is. Tokens come in the order
+// they start in; register tokens for the base, index and segment of a memory operand are inside that
+// operand's token.
+struct crudasm_intel_disasm_token_t
+{
+	U8 value;		// see the token kinds; 0 if there's nothing to say
+	U2 offset;		// from where the instruction's text starts
+	U2 length;
+	U1 kind;		// crudasm_intel_disasm_token_*
+	U1 arg;			// argument number, or crudasm_intel_disasm_token_no_arg
+};
+
+enum
+{
+	crudasm_intel_disasm_token_prefix,		// lock, rep, o16 etc., or a segment written before the mnemonic (value: its number)
+	crudasm_intel_disasm_token_mnemonic,
+	crudasm_intel_disasm_token_register,	// value: register number
+	crudasm_intel_disasm_token_immediate,	// value: the immediate
+	crudasm_intel_disasm_token_target,		// relative branch target; value: the target address
+	crudasm_intel_disasm_token_memory,		// a whole memory argument, with any size keyword; value: the displacement
+											// (for a rip relative argument, the address)
+
+	crudasm_intel_disasm_token_no_arg = 0xff,	// arg of prefix and mnemonic tokens
+	crudasm_intel_disasm_max_tokens = 24		// no instruction needs more tokens than this
+};
+
+// Same as crudasm_intel_disasm_sink(), and also writes up to max_tokens tokens describing the text to tokens
+// (with fewer, the last ones are left out). *num_tokens gets the number written.
+int crudasm_intel_disasm_tokens(struct crudasm_intel_disasm_sink_t *sink, struct ix_icode_t *icode, U8 rel, const char *immT, const char *dispT, U1 dsz,
+	struct crudasm_intel_disasm_token_t *tokens, size_t max_tokens, size_t *num_tokens);
+
+// Where crudasm_intel_disasm_batch() put one instruction's text: sink->buf + offset, length bytes.
+struct crudasm_intel_disasm_span_t
+{
+	size_t offset;
+	size_t length;
+};
+
+// Disassembles count instructions into sink, one right after the other, with no '\0' or anything else
+// in between (invalid opcodes give empty text). rels[i] is rel for icodes[i], as for crudasm_intel_disasm_n();
+// immediates and displacements are always written as numbers. spans[i] gets where icodes[i] went. Returns
+// the number of instructions done: fewer than count if sink ran out of room, in which case truncated is
+// set and the instruction that didn't fit is taken back out, so the caller can make room and carry on
+// from there. Offsets stay good if grow moves the buffer. This is about as fast as calling
+// crudasm_intel_disasm_sink() for each icode; use it to get one arena with spans.
+size_t crudasm_intel_disasm_batch(struct crudasm_intel_disasm_sink_t *sink, struct ix_icode_t *icodes, const U8 *rels, size_t count, U1 dsz,
+	struct crudasm_intel_disasm_span_t *spans);
+
+// For putting the rest of a line around the disassembly: append size bytes of text, or value in lower case
+// hex zero padded to at least digits digits.
+void crudasm_intel_sink_write(struct crudasm_intel_disasm_sink_t *sink, const char *text, size_t size);
+void crudasm_intel_sink_write_hex(struct crudasm_intel_disasm_sink_t *sink, U4 value, int digits);
+
+// Writes at most dest_size bytes to destT, including the terminating '\0' (the text is cut short if
+// it doesn't fit). Returns the length of the text, or -1 if it had to be cut short or dest_size is 0.
+// Invalid opcodes (encoding 0xffffffff) give an empty string.
 // icode -- intermediate code, generated by the decoder
 // rel -- address of instruction plus the length of the instruction in bytes (used for example by relative immediate arguments)
 // destT -- buffer to write the disassembly to
 // immT -- if not NULL, the first immediate encountered will be replaced with this string (i.e. debugging symbol name)
 // dispT -- if not NULL, any displacement will be replaced with this string (i.e. debugging symbol name)
 // dsz -- 0 for 16 bit mode, 1 for 32 bit mode, 2 for 64 bit mode. "default size".
+int crudasm_intel_disasm_n(struct ix_icode_t *icode, U8 rel, char *destT, size_t dest_size, const char *immT, const char *dispT, U1 dsz);
+
+// As crudasm_intel_disasm_n(), for a destT of at least 1024 bytes + strlen(immT) + strlen(dispT).
 void crudasm_intel_disasm(struct ix_icode_t *icode, U8 rel, char *destT, const char *immT, const char *dispT, U1 dsz);
 
 #ifdef __cplusplus